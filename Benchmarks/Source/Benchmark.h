@@ -0,0 +1,45 @@
+/** @file
+ *  @brief Functions shared by the benchmarks */
+#pragma once
+
+#include <Obsidian/Core/Clock.h>
+#include <Obsidian/Defines.h>
+
+/** A benchmark which can be selected by name from the command line. */
+typedef struct Benchmark {
+	const char* Name; /**< Name used to select the benchmark. */
+	void (*Run)();    /**< Runs the benchmark and logs its results. */
+} Benchmark;
+
+/**
+ * Get the next number from a pseudo-random sequence. Every sequence starts from a fixed seed, so each run measures the
+ * same data.
+ * @param state The state of the sequence, which must not be 0.
+ * @return A pseudo-random number.
+ */
+U64 Benchmark_Random(U64* state);
+
+/**
+ * Get the time since a clock was started.
+ * @param clock A clock started with Clock_Start().
+ * @return The elapsed time, in milliseconds.
+ */
+F64 Benchmark_ElapsedMs(Clock* clock);
+
+/**
+ * Time mixed allocations, reallocations and frees through Memory_Allocate() and malloc(). Allocation tracking is
+ * chosen at build time, so its cost is measured by running this in builds with and without OBSIDIAN_MEMORY_TRACKING.
+ */
+void Benchmark_Memory();
+
+/** Time the same workload as Benchmark_Memory() on several threads at once, to measure contention between them. */
+void Benchmark_MemoryThreaded();
+
+/** Compare inserting, finding and replacing values in a slot map against a dictionary keyed by integer IDs. */
+void Benchmark_SlotMap();
+
+/** Compare random lookups in sorted maps of several sizes against bsearch() over the same keys. */
+void Benchmark_SortedMap();
+
+/** Compare radix, merge and parallel sorts against qsort(). */
+void Benchmark_Sort();
@@ -0,0 +1,65 @@
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+#include <string.h>
+
+#include "Benchmark.h"
+
+static const Benchmark Benchmarks[] = {{"Memory", Benchmark_Memory},
+                                       {"MemoryThreaded", Benchmark_MemoryThreaded},
+                                       {"SlotMap", Benchmark_SlotMap},
+                                       {"Sort", Benchmark_Sort},
+                                       {"SortedMap", Benchmark_SortedMap}};
+
+U64 Benchmark_Random(U64* state) {
+	U64 x = *state;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	*state = x;
+
+	return x;
+}
+
+F64 Benchmark_ElapsedMs(Clock* clock) {
+	Clock_Update(clock);
+
+	return clock->Elapsed * 1000.0;
+}
+
+static const Benchmark* FindBenchmark(const char* name) {
+	for (U64 i = 0; i < sizeof(Benchmarks) / sizeof(*Benchmarks); ++i) {
+		if (strcmp(Benchmarks[i].Name, name) == 0) { return &Benchmarks[i]; }
+	}
+
+	return NULL;
+}
+
+static void RunBenchmark(const Benchmark* benchmark) {
+	LogI("===== %s =====", benchmark->Name);
+	benchmark->Run();
+}
+
+// Run every benchmark, or only those named on the command line.
+int main(int argc, const char** argv) {
+	if (!Memory_Initialize()) { return 2; }
+	Logger_Initialize();
+
+	int status = 0;
+	if (argc == 1) {
+		for (U64 i = 0; i < sizeof(Benchmarks) / sizeof(*Benchmarks); ++i) { RunBenchmark(&Benchmarks[i]); }
+	}
+	for (int arg = 1; arg < argc; ++arg) {
+		const Benchmark* benchmark = FindBenchmark(argv[arg]);
+		if (benchmark == NULL) {
+			LogE("Unknown benchmark \"%s\"!", argv[arg]);
+			status = 1;
+			continue;
+		}
+		RunBenchmark(benchmark);
+	}
+
+	Logger_Shutdown();
+	Memory_Shutdown();
+
+	return status;
+}
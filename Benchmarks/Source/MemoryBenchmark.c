@@ -0,0 +1,135 @@
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+#include <Obsidian/Platform/Platform.h>
+#include <stdlib.h>
+
+#include "Benchmark.h"
+
+// Each round makes this many calls, on a working set of up to MEMORY_BENCHMARK_SLOTS blocks, then frees every block.
+#define MEMORY_BENCHMARK_OPERATIONS 2000
+#define MEMORY_BENCHMARK_ROUNDS     200
+#define MEMORY_BENCHMARK_SLOTS      256
+// Largest block requested, so that both small and large allocations are measured.
+#define MEMORY_BENCHMARK_MAX_SIZE 2048
+// Number of threads running the workload at once in the threaded benchmark.
+#define MEMORY_BENCHMARK_THREADS 8
+// Each workload is repeated, and the fastest run is reported to discount interruptions.
+#define MEMORY_BENCHMARK_RUNS 3
+
+// The heap functions a workload runs against, so the engine's allocator and the C library make the same calls.
+typedef struct MemoryBenchmarkHeap {
+	const char* Name;
+	void* (*Allocate)(size_t size);
+	void* (*Reallocate)(void* ptr, size_t size);
+	void (*Free)(void* ptr);
+} MemoryBenchmarkHeap;
+
+// A thread's share of the threaded benchmark.
+typedef struct MemoryBenchmarkThread {
+	const MemoryBenchmarkHeap* Heap;
+	U64 Seed;
+} MemoryBenchmarkThread;
+
+static void* EngineAllocate(size_t size) {
+	return Memory_Allocate(size, MemoryTag_Game);
+}
+
+static void* EngineReallocate(void* ptr, size_t size) {
+	return Memory_Reallocate(ptr, size);
+}
+
+static const MemoryBenchmarkHeap MemoryHeaps[] = {{"Memory_Allocate", EngineAllocate, EngineReallocate, Memory_Free},
+                                                  {"malloc", malloc, realloc, free}};
+
+// Run rounds of randomly mixed allocations, reallocations and frees.
+static void RunWorkload(const MemoryBenchmarkHeap* heap, U64 seed) {
+	void* slots[MEMORY_BENCHMARK_SLOTS] = {0};
+	U64 random                          = seed;
+
+	for (U32 round = 0; round < MEMORY_BENCHMARK_ROUNDS; ++round) {
+		for (U32 i = 0; i < MEMORY_BENCHMARK_OPERATIONS; ++i) {
+			const U64 r       = Benchmark_Random(&random);
+			void** slot       = &slots[r % MEMORY_BENCHMARK_SLOTS];
+			const size_t size = 1 + ((r >> 16) % MEMORY_BENCHMARK_MAX_SIZE);
+
+			if (*slot == NULL) {
+				*slot = heap->Allocate(size);
+			} else if ((r >> 32) & 1) {
+				void* resized = heap->Reallocate(*slot, size);
+				if (resized) { *slot = resized; }
+			} else {
+				heap->Free(*slot);
+				*slot = NULL;
+			}
+		}
+
+		for (U32 i = 0; i < MEMORY_BENCHMARK_SLOTS; ++i) {
+			heap->Free(slots[i]);
+			slots[i] = NULL;
+		}
+	}
+}
+
+static void RunWorkloadThread(void* userData) {
+	const MemoryBenchmarkThread* thread = userData;
+	RunWorkload(thread->Heap, thread->Seed);
+}
+
+void Benchmark_Memory() {
+#if OBSIDIAN_MEMORY_TRACKING == 1
+	LogI("Allocation tracking is enabled.");
+#else
+	LogI("Allocation tracking is disabled.");
+#endif
+
+	const U64 operations = MEMORY_BENCHMARK_ROUNDS * MEMORY_BENCHMARK_OPERATIONS;
+	for (U64 i = 0; i < sizeof(MemoryHeaps) / sizeof(*MemoryHeaps); ++i) {
+		F64 best = 0.0;
+		for (U32 run = 0; run < MEMORY_BENCHMARK_RUNS; ++run) {
+			Clock clock;
+			Clock_Start(&clock);
+			RunWorkload(&MemoryHeaps[i], 0x9E3779B97F4A7C15ull);
+			const F64 elapsed = Benchmark_ElapsedMs(&clock);
+			if (run == 0 || elapsed < best) { best = elapsed; }
+		}
+
+		LogI("%-16s %llu operations  %9.3f ms  %7.2f ns/operation",
+		     MemoryHeaps[i].Name,
+		     operations,
+		     best,
+		     (best * 1000000.0) / operations);
+	}
+}
+
+void Benchmark_MemoryThreaded() {
+	const U64 operations = MEMORY_BENCHMARK_THREADS * MEMORY_BENCHMARK_ROUNDS * MEMORY_BENCHMARK_OPERATIONS;
+	for (U64 i = 0; i < sizeof(MemoryHeaps) / sizeof(*MemoryHeaps); ++i) {
+		MemoryBenchmarkThread workloads[MEMORY_BENCHMARK_THREADS];
+		for (U32 t = 0; t < MEMORY_BENCHMARK_THREADS; ++t) {
+			workloads[t] = (MemoryBenchmarkThread){&MemoryHeaps[i], 0x9E3779B97F4A7C15ull * (t + 1)};
+		}
+
+		F64 best = 0.0;
+		for (U32 run = 0; run < MEMORY_BENCHMARK_RUNS; ++run) {
+			PlatformThread threads[MEMORY_BENCHMARK_THREADS];
+			Clock clock;
+			Clock_Start(&clock);
+			for (U32 t = 0; t < MEMORY_BENCHMARK_THREADS; ++t) {
+				threads[t] = Platform_ThreadCreate(RunWorkloadThread, &workloads[t]);
+				if (threads[t] == NULL) { RunWorkloadThread(&workloads[t]); }
+			}
+			for (U32 t = 0; t < MEMORY_BENCHMARK_THREADS; ++t) {
+				if (threads[t]) { Platform_ThreadJoin(threads[t]); }
+			}
+			const F64 elapsed = Benchmark_ElapsedMs(&clock);
+			if (run == 0 || elapsed < best) { best = elapsed; }
+		}
+
+		LogI("%-16s %u threads  %llu operations  %9.3f ms  %7.2f ns/operation",
+		     MemoryHeaps[i].Name,
+		     MEMORY_BENCHMARK_THREADS,
+		     operations,
+		     best,
+		     (best * 1000000.0) / operations);
+	}
+}
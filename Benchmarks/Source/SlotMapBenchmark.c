@@ -0,0 +1,98 @@
+#include <Obsidian/Containers/Dictionary.h>
+#include <Obsidian/Containers/SlotMap.h>
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+
+#include "Benchmark.h"
+
+// Number of values held, and the number of lookups and replacements timed.
+#define SLOT_MAP_BENCHMARK_COUNT      100000
+#define SLOT_MAP_BENCHMARK_OPERATIONS 1000000
+
+static void LogResult(const char* container, const char* operation, F64 elapsed, U64 count) {
+	LogI("%-10s %-8s %9.3f ms  %7.2f ns/operation", container, operation, elapsed, (elapsed * 1000000.0) / count);
+}
+
+// Insert values, look them up at random and replace them at random, through the handles the slot map gave out.
+static void BenchmarkSlotMap() {
+	U64* map               = SlotMap_CreateWithCapacity(U64, SLOT_MAP_BENCHMARK_COUNT);
+	SlotMapHandle* handles = Memory_Allocate(SLOT_MAP_BENCHMARK_COUNT * sizeof(SlotMapHandle), MemoryTag_Array);
+	if (map == NULL || handles == NULL) {
+		LogE("[Benchmark] Failed to allocate memory for %u slot map values!", SLOT_MAP_BENCHMARK_COUNT);
+		Memory_Free(handles);
+		if (map) { SlotMap_Destroy(&map); }
+		return;
+	}
+
+	Clock clock;
+	Clock_Start(&clock);
+	for (U64 i = 0; i < SLOT_MAP_BENCHMARK_COUNT; ++i) { handles[i] = SlotMap_Insert(&map, i); }
+	LogResult("SlotMap", "Insert", Benchmark_ElapsedMs(&clock), SLOT_MAP_BENCHMARK_COUNT);
+
+	U64 random = 0x9E3779B97F4A7C15ull;
+	U64 sum    = 0;
+	Clock_Start(&clock);
+	for (U64 i = 0; i < SLOT_MAP_BENCHMARK_OPERATIONS; ++i) {
+		sum += *(U64*) SlotMap_Get(&map, handles[Benchmark_Random(&random) % SLOT_MAP_BENCHMARK_COUNT]);
+	}
+	LogResult("SlotMap", "Get", Benchmark_ElapsedMs(&clock), SLOT_MAP_BENCHMARK_OPERATIONS);
+
+	Clock_Start(&clock);
+	for (U64 i = 0; i < SLOT_MAP_BENCHMARK_OPERATIONS; ++i) {
+		const U64 index = Benchmark_Random(&random) % SLOT_MAP_BENCHMARK_COUNT;
+		SlotMap_Remove(&map, handles[index], NULL);
+		handles[index] = SlotMap_Insert(&map, i);
+	}
+	LogResult("SlotMap", "Replace", Benchmark_ElapsedMs(&clock), SLOT_MAP_BENCHMARK_OPERATIONS);
+	LogD("Checksum: %llu", sum);
+
+	Memory_Free(handles);
+	SlotMap_Destroy(&map);
+}
+
+// The same operations through a dictionary keyed by integer IDs, the usual alternative to a slot map.
+static void BenchmarkDictionary() {
+	U64* dict = Dictionary_CreateIntWithCapacity(U64, SLOT_MAP_BENCHMARK_COUNT);
+	U64* ids  = Memory_Allocate(SLOT_MAP_BENCHMARK_COUNT * sizeof(U64), MemoryTag_Array);
+	if (dict == NULL || ids == NULL) {
+		LogE("[Benchmark] Failed to allocate memory for %u dictionary values!", SLOT_MAP_BENCHMARK_COUNT);
+		Memory_Free(ids);
+		if (dict) { Dictionary_Destroy(&dict); }
+		return;
+	}
+
+	U64 nextId = 0;
+	Clock clock;
+	Clock_Start(&clock);
+	for (U64 i = 0; i < SLOT_MAP_BENCHMARK_COUNT; ++i) {
+		ids[i] = nextId++;
+		Dictionary_InsertInt(&dict, ids[i], i);
+	}
+	LogResult("Dictionary", "Insert", Benchmark_ElapsedMs(&clock), SLOT_MAP_BENCHMARK_COUNT);
+
+	U64 random = 0x9E3779B97F4A7C15ull;
+	U64 sum    = 0;
+	Clock_Start(&clock);
+	for (U64 i = 0; i < SLOT_MAP_BENCHMARK_OPERATIONS; ++i) {
+		sum += *(U64*) Dictionary_FindInt(&dict, ids[Benchmark_Random(&random) % SLOT_MAP_BENCHMARK_COUNT]);
+	}
+	LogResult("Dictionary", "Get", Benchmark_ElapsedMs(&clock), SLOT_MAP_BENCHMARK_OPERATIONS);
+
+	Clock_Start(&clock);
+	for (U64 i = 0; i < SLOT_MAP_BENCHMARK_OPERATIONS; ++i) {
+		const U64 index = Benchmark_Random(&random) % SLOT_MAP_BENCHMARK_COUNT;
+		Dictionary_RemoveInt(&dict, ids[index], NULL);
+		ids[index] = nextId++;
+		Dictionary_InsertInt(&dict, ids[index], i);
+	}
+	LogResult("Dictionary", "Replace", Benchmark_ElapsedMs(&clock), SLOT_MAP_BENCHMARK_OPERATIONS);
+	LogD("Checksum: %llu", sum);
+
+	Memory_Free(ids);
+	Dictionary_Destroy(&dict);
+}
+
+void Benchmark_SlotMap() {
+	BenchmarkSlotMap();
+	BenchmarkDictionary();
+}
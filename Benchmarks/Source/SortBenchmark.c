@@ -0,0 +1,158 @@
+#include <Obsidian/Containers/Sort.h>
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+#include <stdlib.h>
+
+#include "Benchmark.h"
+
+// Each sort is repeated, and the fastest run is reported to discount interruptions.
+#define SORT_BENCHMARK_RUNS 5
+
+typedef enum SortMethod {
+	SortMethod_QSort,
+	SortMethod_Stable,
+	SortMethod_Radix,
+	SortMethod_RadixParallel,
+	SortMethod_Count
+} SortMethod;
+
+static const char* SortMethodNames[SortMethod_Count] = {"qsort", "Sort_Stable", "Sort_Radix", "Sort_RadixParallel"};
+
+// A key and the index of the element it belongs to, for the sorts which take a comparison function.
+typedef struct SortPair32 {
+	U32 Key;
+	U32 Value;
+} SortPair32;
+
+typedef struct SortPair64 {
+	U64 Key;
+	U32 Value;
+} SortPair64;
+
+// Buffers large enough to sort the largest count with any method.
+typedef struct SortBuffers {
+	void* Keys;    // Keys for the radix sorts.
+	U32* Values;   // Values for the radix sorts.
+	void* Pairs;   // Keys and values for the comparison sorts.
+	void* Scratch; // Scratch buffer given to every sort, so no time is spent allocating.
+} SortBuffers;
+
+static I32 ComparePair32(const void* a, const void* b) {
+	const U32 keyA = ((const SortPair32*) a)->Key;
+	const U32 keyB = ((const SortPair32*) b)->Key;
+
+	return (keyA > keyB) - (keyA < keyB);
+}
+
+static I32 ComparePair64(const void* a, const void* b) {
+	const U64 keyA = ((const SortPair64*) a)->Key;
+	const U64 keyB = ((const SortPair64*) b)->Key;
+
+	return (keyA > keyB) - (keyA < keyB);
+}
+
+static U64 GetKey(SortMethod method, U32 keySize, const SortBuffers* buffers, U64 index) {
+	const B8 pairs = method == SortMethod_QSort || method == SortMethod_Stable;
+	if (keySize == sizeof(U32)) {
+		return pairs ? ((SortPair32*) buffers->Pairs)[index].Key : ((U32*) buffers->Keys)[index];
+	}
+
+	return pairs ? ((SortPair64*) buffers->Pairs)[index].Key : ((U64*) buffers->Keys)[index];
+}
+
+// Sort a copy of the source keys with the given method, and return the time taken in milliseconds.
+static F64 TimeSort(SortMethod method, U32 keySize, const U64* source, U64 count, SortBuffers* buffers) {
+	for (U64 i = 0; i < count; ++i) {
+		buffers->Values[i] = i;
+		if (keySize == sizeof(U32)) {
+			((U32*) buffers->Keys)[i]         = source[i];
+			((SortPair32*) buffers->Pairs)[i] = (SortPair32){source[i], i};
+		} else {
+			((U64*) buffers->Keys)[i]         = source[i];
+			((SortPair64*) buffers->Pairs)[i] = (SortPair64){source[i], i};
+		}
+	}
+
+	const U64 stride            = keySize == sizeof(U32) ? sizeof(SortPair32) : sizeof(SortPair64);
+	const SortCompareFn compare = keySize == sizeof(U32) ? ComparePair32 : ComparePair64;
+	B8 sorted                   = TRUE;
+
+	Clock clock;
+	Clock_Start(&clock);
+	switch (method) {
+		case SortMethod_QSort:
+			qsort(buffers->Pairs, count, stride, compare);
+			break;
+		case SortMethod_Stable:
+			sorted = Sort_Stable(buffers->Pairs, count, stride, compare, buffers->Scratch);
+			break;
+		case SortMethod_Radix:
+			sorted = keySize == sizeof(U32) ? Sort_RadixU32(buffers->Keys, buffers->Values, count, buffers->Scratch)
+			                                : Sort_RadixU64(buffers->Keys, buffers->Values, count, buffers->Scratch);
+			break;
+		case SortMethod_RadixParallel:
+			sorted = keySize == sizeof(U32)
+			           ? Sort_RadixParallelU32(buffers->Keys, buffers->Values, count, 0, buffers->Scratch)
+			           : Sort_RadixParallelU64(buffers->Keys, buffers->Values, count, 0, buffers->Scratch);
+			break;
+		default:
+			break;
+	}
+	const F64 elapsed = Benchmark_ElapsedMs(&clock);
+
+	for (U64 i = 1; i < count && sorted; ++i) {
+		sorted = GetKey(method, keySize, buffers, i - 1) <= GetKey(method, keySize, buffers, i);
+	}
+	if (!sorted) { LogE("[Benchmark] %s failed to sort %llu keys!", SortMethodNames[method], count); }
+
+	return elapsed;
+}
+
+static void BenchmarkKeys(U32 keySize, const U64* source, U64 count, SortBuffers* buffers) {
+	F64 qsortTime = 0.0;
+	for (SortMethod method = 0; method < SortMethod_Count; ++method) {
+		F64 best = 0.0;
+		for (U32 run = 0; run < SORT_BENCHMARK_RUNS; ++run) {
+			const F64 elapsed = TimeSort(method, keySize, source, count, buffers);
+			if (run == 0 || elapsed < best) { best = elapsed; }
+		}
+		if (method == SortMethod_QSort) { qsortTime = best; }
+
+		LogI("U%u x %7llu  %-18s %9.3f ms  %7.2f ns/key  %5.2fx qsort",
+		     keySize * 8,
+		     count,
+		     SortMethodNames[method],
+		     best,
+		     (best * 1000000.0) / count,
+		     qsortTime / best);
+	}
+}
+
+void Benchmark_Sort() {
+	static const U64 counts[] = {10000, 100000, 1000000};
+	const U64 maxCount        = counts[(sizeof(counts) / sizeof(*counts)) - 1];
+
+	SortBuffers buffers;
+	U64* source     = Memory_Allocate(maxCount * sizeof(U64), MemoryTag_Array);
+	buffers.Keys    = Memory_Allocate(maxCount * sizeof(U64), MemoryTag_Array);
+	buffers.Values  = Memory_Allocate(maxCount * sizeof(U32), MemoryTag_Array);
+	buffers.Pairs   = Memory_Allocate(maxCount * sizeof(SortPair64), MemoryTag_Array);
+	buffers.Scratch = Memory_Allocate(maxCount * sizeof(SortPair64), MemoryTag_Array);
+	if (source && buffers.Keys && buffers.Values && buffers.Pairs && buffers.Scratch) {
+		U64 random = 0x9E3779B97F4A7C15ull;
+		for (U64 i = 0; i < maxCount; ++i) { source[i] = Benchmark_Random(&random); }
+
+		for (U64 i = 0; i < sizeof(counts) / sizeof(*counts); ++i) {
+			BenchmarkKeys(sizeof(U32), source, counts[i], &buffers);
+			BenchmarkKeys(sizeof(U64), source, counts[i], &buffers);
+		}
+	} else {
+		LogE("[Benchmark] Failed to allocate memory to sort %llu keys!", maxCount);
+	}
+
+	Memory_Free(buffers.Scratch);
+	Memory_Free(buffers.Pairs);
+	Memory_Free(buffers.Values);
+	Memory_Free(buffers.Keys);
+	Memory_Free(source);
+}
@@ -0,0 +1,71 @@
+#include <Obsidian/Containers/SortedMap.h>
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+#include <stdlib.h>
+
+#include "Benchmark.h"
+
+// Number of random lookups timed for each map size.
+#define SORTED_MAP_BENCHMARK_LOOKUPS 1000000
+
+static I32 CompareKeys(const void* a, const void* b) {
+	const U64 keyA = *(const U64*) a;
+	const U64 keyB = *(const U64*) b;
+
+	return (keyA > keyB) - (keyA < keyB);
+}
+
+static void BenchmarkCount(U64 count, U64* keys, U32* values, U64* lookups) {
+	// Strictly ascending keys with random gaps between them.
+	U64 random = 0x9E3779B97F4A7C15ull;
+	for (U64 i = 0; i < count; ++i) {
+		keys[i]   = (i ? keys[i - 1] : 0) + 1 + (Benchmark_Random(&random) % 16);
+		values[i] = i;
+	}
+	for (U64 i = 0; i < SORTED_MAP_BENCHMARK_LOOKUPS; ++i) { lookups[i] = keys[Benchmark_Random(&random) % count]; }
+
+	U32* map = SortedMap_CreateWithCapacity(U32, count);
+	if (map == NULL || !SortedMap_Build(&map, keys, values, count)) {
+		LogE("[Benchmark] Failed to build a sorted map of %llu keys!", count);
+		if (map) { SortedMap_Destroy(&map); }
+		return;
+	}
+
+	U64 found = 0;
+	Clock clock;
+	Clock_Start(&clock);
+	for (U64 i = 0; i < SORTED_MAP_BENCHMARK_LOOKUPS; ++i) { found += SortedMap_Find(&map, lookups[i]) != NULL; }
+	const F64 mapTime = Benchmark_ElapsedMs(&clock);
+
+	Clock_Start(&clock);
+	for (U64 i = 0; i < SORTED_MAP_BENCHMARK_LOOKUPS; ++i) {
+		found += bsearch(&lookups[i], keys, count, sizeof(U64), CompareKeys) != NULL;
+	}
+	const F64 bsearchTime = Benchmark_ElapsedMs(&clock);
+
+	if (found != SORTED_MAP_BENCHMARK_LOOKUPS * 2) { LogE("[Benchmark] Lookups missed keys in the map!"); }
+	LogI("%8llu keys  SortedMap_Find %7.2f ns/lookup  bsearch %7.2f ns/lookup",
+	     count,
+	     (mapTime * 1000000.0) / SORTED_MAP_BENCHMARK_LOOKUPS,
+	     (bsearchTime * 1000000.0) / SORTED_MAP_BENCHMARK_LOOKUPS);
+
+	SortedMap_Destroy(&map);
+}
+
+void Benchmark_SortedMap() {
+	static const U64 counts[] = {1000, 32000, 1000000};
+	const U64 maxCount        = counts[(sizeof(counts) / sizeof(*counts)) - 1];
+
+	U64* keys    = Memory_Allocate(maxCount * sizeof(U64), MemoryTag_Array);
+	U32* values  = Memory_Allocate(maxCount * sizeof(U32), MemoryTag_Array);
+	U64* lookups = Memory_Allocate(SORTED_MAP_BENCHMARK_LOOKUPS * sizeof(U64), MemoryTag_Array);
+	if (keys && values && lookups) {
+		for (U64 i = 0; i < sizeof(counts) / sizeof(*counts); ++i) { BenchmarkCount(counts[i], keys, values, lookups); }
+	} else {
+		LogE("[Benchmark] Failed to allocate memory for %llu sorted map keys!", maxCount);
+	}
+
+	Memory_Free(lookups);
+	Memory_Free(values);
+	Memory_Free(keys);
+}
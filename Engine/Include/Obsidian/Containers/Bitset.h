@@ -0,0 +1,126 @@
+/** @file
+ *  @brief Dynamically-sized bitset container */
+#pragma once
+
+#include <Obsidian/Defines.h>
+
+/**
+ * A set of bits, packed 64 to a word. Bits past the end of the set are always kept clear, so whole words can be
+ * compared and counted without masking.
+ */
+typedef struct Bitset {
+	U64* Words;    /**< The bits, with bit i stored in bit (i % 64) of word (i / 64). */
+	U64 BitCount;  /**< Number of bits in the set. */
+	U64 WordCount; /**< Number of words holding the bits. */
+} Bitset;
+
+/**
+ * Create a bitset with every bit clear.
+ * @param bitset The bitset to initialize.
+ * @param bitCount The number of bits in the set.
+ * @return TRUE on success, FALSE upon allocation failure.
+ */
+OAPI B8 Bitset_Create(Bitset* bitset, U64 bitCount);
+
+/**
+ * Destroy a bitset, releasing its memory.
+ * @param bitset The bitset to destroy.
+ */
+OAPI void Bitset_Destroy(Bitset* bitset);
+
+/**
+ * Change the number of bits in a bitset. Bits added to the end are clear.
+ * @param bitset The bitset to resize.
+ * @param bitCount The new number of bits in the set.
+ * @return TRUE on success, FALSE upon allocation failure, in which case the bitset is unchanged.
+ */
+OAPI B8 Bitset_Resize(Bitset* bitset, U64 bitCount);
+
+/**
+ * Set a bit.
+ * @param bitset The bitset.
+ * @param index The index of the bit.
+ */
+OAPI void Bitset_Set(Bitset* bitset, U64 index);
+
+/**
+ * Clear a bit.
+ * @param bitset The bitset.
+ * @param index The index of the bit.
+ */
+OAPI void Bitset_Clear(Bitset* bitset, U64 index);
+
+/**
+ * Set or clear a bit.
+ * @param bitset The bitset.
+ * @param index The index of the bit.
+ * @param value TRUE to set the bit, FALSE to clear it.
+ */
+OAPI void Bitset_Assign(Bitset* bitset, U64 index, B8 value);
+
+/**
+ * Determine whether a bit is set.
+ * @param bitset The bitset.
+ * @param index The index of the bit.
+ * @return TRUE if the bit is set, FALSE otherwise.
+ */
+OAPI B8 Bitset_Test(const Bitset* bitset, U64 index);
+
+/**
+ * Set or clear every bit.
+ * @param bitset The bitset.
+ * @param value TRUE to set every bit, FALSE to clear every bit.
+ */
+OAPI void Bitset_Fill(Bitset* bitset, B8 value);
+
+/**
+ * Count the bits which are set.
+ * @param bitset The bitset.
+ * @return The number of bits which are set.
+ */
+OAPI U64 Bitset_Count(const Bitset* bitset);
+
+/**
+ * Find the next set bit, to iterate over the set bits in order:
+ * `for (U64 i = Bitset_Next(&set, 0); i < set.BitCount; i = Bitset_Next(&set, i + 1))`
+ * @param bitset The bitset.
+ * @param index The index to start searching from.
+ * @return The index of the first set bit at or after the given index, or the bitset's BitCount if there is none.
+ */
+OAPI U64 Bitset_Next(const Bitset* bitset, U64 index);
+
+/**
+ * Copy the bits of one bitset into another of the same size.
+ * @param dst The bitset to copy into.
+ * @param src The bitset to copy from.
+ */
+OAPI void Bitset_Copy(Bitset* dst, const Bitset* src);
+
+/**
+ * Clear every bit of a bitset which is clear in another of the same size.
+ * @param dst The bitset to modify.
+ * @param src The bitset to intersect with.
+ */
+OAPI void Bitset_And(Bitset* dst, const Bitset* src);
+
+/**
+ * Set every bit of a bitset which is set in another of the same size.
+ * @param dst The bitset to modify.
+ * @param src The bitset to unite with.
+ */
+OAPI void Bitset_Or(Bitset* dst, const Bitset* src);
+
+/**
+ * Clear every bit of a bitset which is set in another of the same size.
+ * @param dst The bitset to modify.
+ * @param src The bitset whose bits will be removed.
+ */
+OAPI void Bitset_AndNot(Bitset* dst, const Bitset* src);
+
+/**
+ * Determine whether two bitsets of the same size hold the same bits.
+ * @param a The first bitset.
+ * @param b The second bitset.
+ * @return TRUE if the bitsets are equal, FALSE otherwise.
+ */
+OAPI B8 Bitset_Equal(const Bitset* a, const Bitset* b);
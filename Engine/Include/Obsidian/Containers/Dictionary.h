@@ -0,0 +1,264 @@
+/** @file
+ *  @brief Hash map container, using open addressing with SIMD group probing */
+#pragma once
+
+#include <Obsidian/Defines.h>
+
+static const U32 Dictionary_DefaultCapacity = 16;
+
+typedef void** DictionaryT;
+typedef const void* const* ConstDictionaryT;
+
+/**
+ * Hash a key.
+ * @param key A pointer to the key.
+ * @return The key's hash. Every bit should depend on the whole key.
+ */
+typedef U64 (*DictionaryHashFn)(const void* key);
+
+/**
+ * Compare two keys.
+ * @param a A pointer to the first key.
+ * @param b A pointer to the second key.
+ * @return TRUE if the keys are equal, FALSE otherwise.
+ */
+typedef B8 (*DictionaryEqualFn)(const void* a, const void* b);
+
+// ===== Internal function implementations =====
+
+/**
+ * Create a dictionary. The dictionary is a pointer to its values, which are indexed by slot, so it can be indexed like
+ * a normal array of values. Keys and values are copied into the dictionary. Users should use one of the helper macros
+ * such as Dictionary_Create() instead of this function directly.
+ * @param keySize The size of each key, in bytes.
+ * @param valueSize The size of each value, in bytes.
+ * @param capacity The amount of entries the dictionary will be able to hold without growing.
+ * @param hash The function used to hash keys.
+ * @param equal The function used to compare keys.
+ * @return NULL upon allocation failure, otherwise a pointer to the created dictionary.
+ * @sa Dictionary_Create(), Dictionary_CreateString(), Dictionary_CreateInt()
+ */
+OAPI void* _Dictionary_Create(U64 keySize, U64 valueSize, U64 capacity, DictionaryHashFn hash, DictionaryEqualFn equal);
+
+/**
+ * Destroys a dictionary.
+ * @param dict The dictionary to destroy.
+ */
+OAPI void _Dictionary_Destroy(DictionaryT dict);
+
+/**
+ * Get the number of entries in the dictionary.
+ * @param dict A pointer to the dictionary.
+ * @return The number of entries in the dictionary.
+ */
+OAPI U64 _Dictionary_Size(ConstDictionaryT dict);
+
+/**
+ * Get the number of slots in the dictionary. Slot indices range from 0 up to, but not including, this number.
+ * @param dict A pointer to the dictionary.
+ * @return The number of slots in the dictionary.
+ */
+OAPI U64 _Dictionary_Capacity(ConstDictionaryT dict);
+
+/**
+ * Ensure the dictionary can hold the given number of entries without growing.
+ * @param dict A pointer to the dictionary.
+ * @param count The number of entries to reserve space for.
+ * @return TRUE upon successful reserve, FALSE upon failure.
+ */
+OAPI B8 _Dictionary_Reserve(DictionaryT dict, U64 count);
+
+/**
+ * Insert an entry into the dictionary, replacing the value of an existing entry with the same key. The key and value
+ * must not point into the dictionary itself.
+ * @param dict A pointer to the dictionary.
+ * @param key A pointer to the key.
+ * @param value A pointer to the value, or NULL to zero-initialize the value of a new entry.
+ * @return NULL upon allocation failure, otherwise a pointer to the value within the dictionary.
+ */
+OAPI void* _Dictionary_Insert(DictionaryT dict, const void* key, const void* value);
+
+/**
+ * Find the value of the entry with the given key.
+ * @param dict A pointer to the dictionary.
+ * @param key A pointer to the key to search for.
+ * @return NULL if there is no such entry, otherwise a pointer to the value within the dictionary.
+ */
+OAPI void* _Dictionary_Find(ConstDictionaryT dict, const void* key);
+
+/**
+ * Remove the entry with the given key from the dictionary.
+ * @param dict A pointer to the dictionary.
+ * @param key A pointer to the key to remove.
+ * @param[out] value A pointer to where the removed value will be placed, or NULL.
+ * @return TRUE if the entry was removed, FALSE if there was no such entry.
+ */
+OAPI B8 _Dictionary_Remove(DictionaryT dict, const void* key, void* value);
+
+/**
+ * Remove every entry from the dictionary, keeping its capacity.
+ * @param dict A pointer to the dictionary.
+ */
+OAPI void _Dictionary_Clear(DictionaryT dict);
+
+/**
+ * Find the next slot which holds an entry, to iterate over the dictionary. Inserting into the dictionary while
+ * iterating may move entries to different slots.
+ * @param dict A pointer to the dictionary.
+ * @param slot The slot to start searching from.
+ * @return The first slot at or after the given slot which holds an entry, or the dictionary's capacity if there is
+ * none.
+ */
+OAPI U64 _Dictionary_Next(ConstDictionaryT dict, U64 slot);
+
+/**
+ * Get the key of the entry in a slot.
+ * @param dict A pointer to the dictionary.
+ * @param slot A slot which holds an entry.
+ * @return A pointer to the key within the dictionary.
+ */
+OAPI const void* _Dictionary_KeyAt(ConstDictionaryT dict, U64 slot);
+
+// ===== Key helpers =====
+
+/**
+ * Hash a string key, for dictionaries whose keys are const char*. Strings are not copied, so they must outlive the
+ * dictionary.
+ * @param key A pointer to a const char*.
+ * @return The string's hash.
+ */
+OAPI U64 Dictionary_HashString(const void* key);
+
+/**
+ * Compare two string keys.
+ * @param a A pointer to a const char*.
+ * @param b A pointer to a const char*.
+ * @return TRUE if the strings are equal, FALSE otherwise.
+ */
+OAPI B8 Dictionary_EqualString(const void* a, const void* b);
+
+/**
+ * Hash an integer key, for dictionaries whose keys are U64.
+ * @param key A pointer to a U64.
+ * @return The integer's hash.
+ */
+OAPI U64 Dictionary_HashInt(const void* key);
+
+/**
+ * Compare two integer keys.
+ * @param a A pointer to a U64.
+ * @param b A pointer to a U64.
+ * @return TRUE if the integers are equal, FALSE otherwise.
+ */
+OAPI B8 Dictionary_EqualInt(const void* a, const void* b);
+
+// ===== User-facing macro implementations =====
+
+/**
+ * Create a dictionary.
+ * @param keyType The type of the dictionary's keys.
+ * @param valueType The type of the dictionary's values.
+ * @param hashFn The function used to hash keys.
+ * @param equalFn The function used to compare keys.
+ * @return The newly created dictionary.
+ */
+#define Dictionary_Create(keyType, valueType, hashFn, equalFn) \
+	_Dictionary_Create(sizeof(keyType), sizeof(valueType), Dictionary_DefaultCapacity, hashFn, equalFn)
+
+/**
+ * Create a dictionary with a specified capacity.
+ * @param keyType The type of the dictionary's keys.
+ * @param valueType The type of the dictionary's values.
+ * @param count The amount of entries the dictionary will be able to hold without growing.
+ * @param hashFn The function used to hash keys.
+ * @param equalFn The function used to compare keys.
+ * @return The newly created dictionary.
+ */
+#define Dictionary_CreateWithCapacity(keyType, valueType, count, hashFn, equalFn) \
+	_Dictionary_Create(sizeof(keyType), sizeof(valueType), count, hashFn, equalFn)
+
+/**
+ * Create a dictionary keyed by const char* strings, which are not copied.
+ * @param valueType The type of the dictionary's values.
+ * @return The newly created dictionary.
+ */
+#define Dictionary_CreateString(valueType) \
+	Dictionary_Create(const char*, valueType, Dictionary_HashString, Dictionary_EqualString)
+
+/**
+ * Create a dictionary keyed by const char* strings with a specified capacity.
+ * @param valueType The type of the dictionary's values.
+ * @param count The amount of entries the dictionary will be able to hold without growing.
+ * @return The newly created dictionary.
+ */
+#define Dictionary_CreateStringWithCapacity(valueType, count) \
+	Dictionary_CreateWithCapacity(const char*, valueType, count, Dictionary_HashString, Dictionary_EqualString)
+
+/**
+ * Create a dictionary keyed by U64 integers.
+ * @param valueType The type of the dictionary's values.
+ * @return The newly created dictionary.
+ */
+#define Dictionary_CreateInt(valueType) Dictionary_Create(U64, valueType, Dictionary_HashInt, Dictionary_EqualInt)
+
+/**
+ * Create a dictionary keyed by U64 integers with a specified capacity.
+ * @param valueType The type of the dictionary's values.
+ * @param count The amount of entries the dictionary will be able to hold without growing.
+ * @return The newly created dictionary.
+ */
+#define Dictionary_CreateIntWithCapacity(valueType, count) \
+	Dictionary_CreateWithCapacity(U64, valueType, count, Dictionary_HashInt, Dictionary_EqualInt)
+
+/** Convenience macro for _Dictionary_Destroy(). */
+#define Dictionary_Destroy(dict) _Dictionary_Destroy((DictionaryT) dict)
+
+/** Convenience macro for _Dictionary_Size(). */
+#define Dictionary_Size(dict) _Dictionary_Size((ConstDictionaryT) dict)
+
+/** Convenience macro for _Dictionary_Capacity(). */
+#define Dictionary_Capacity(dict) _Dictionary_Capacity((ConstDictionaryT) dict)
+
+/** Convenience macro for _Dictionary_Reserve(). */
+#define Dictionary_Reserve(dict, count) _Dictionary_Reserve((DictionaryT) dict, count)
+
+/** Convenience macro for _Dictionary_Insert(). */
+#define Dictionary_Insert(dict, key, value) \
+	_Dictionary_Insert((DictionaryT) dict, (const void*) &key, (const void*) &value)
+
+/** Convenience macro for _Dictionary_Find(). */
+#define Dictionary_Find(dict, key) _Dictionary_Find((ConstDictionaryT) dict, (const void*) &key)
+
+/** Convenience macro for _Dictionary_Remove(). */
+#define Dictionary_Remove(dict, key, value) _Dictionary_Remove((DictionaryT) dict, (const void*) &key, (void*) value)
+
+/** Convenience macro for _Dictionary_Clear(). */
+#define Dictionary_Clear(dict) _Dictionary_Clear((DictionaryT) dict)
+
+/** Convenience macro for _Dictionary_Next(). */
+#define Dictionary_Next(dict, slot) _Dictionary_Next((ConstDictionaryT) dict, slot)
+
+/** Convenience macro for _Dictionary_KeyAt(). */
+#define Dictionary_KeyAt(dict, slot) _Dictionary_KeyAt((ConstDictionaryT) dict, slot)
+
+/** Convenience macro for _Dictionary_Insert(), for dictionaries keyed by strings. */
+#define Dictionary_InsertString(dict, key, value) \
+	_Dictionary_Insert((DictionaryT) dict, (const void*) &(const char*){key}, (const void*) &value)
+
+/** Convenience macro for _Dictionary_Find(), for dictionaries keyed by strings. */
+#define Dictionary_FindString(dict, key) _Dictionary_Find((ConstDictionaryT) dict, (const void*) &(const char*){key})
+
+/** Convenience macro for _Dictionary_Remove(), for dictionaries keyed by strings. */
+#define Dictionary_RemoveString(dict, key, value) \
+	_Dictionary_Remove((DictionaryT) dict, (const void*) &(const char*){key}, (void*) value)
+
+/** Convenience macro for _Dictionary_Insert(), for dictionaries keyed by integers. */
+#define Dictionary_InsertInt(dict, key, value) \
+	_Dictionary_Insert((DictionaryT) dict, (const void*) &(U64){key}, (const void*) &value)
+
+/** Convenience macro for _Dictionary_Find(), for dictionaries keyed by integers. */
+#define Dictionary_FindInt(dict, key) _Dictionary_Find((ConstDictionaryT) dict, (const void*) &(U64){key})
+
+/** Convenience macro for _Dictionary_Remove(), for dictionaries keyed by integers. */
+#define Dictionary_RemoveInt(dict, key, value) \
+	_Dictionary_Remove((DictionaryT) dict, (const void*) &(U64){key}, (void*) value)
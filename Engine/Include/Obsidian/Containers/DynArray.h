@@ -6,24 +6,80 @@
 
 static const U32 DynArray_DefaultCapacity = 8;
 
+/** Size of the metadata stored just before the elements of every dynamic array. */
+#define DYNARRAY_HEADER_SIZE 32
+
 typedef void** DynArrayT;
 typedef const void* const* ConstDynArrayT;
 
+/** How a dynamic array chooses its new capacity when it runs out of room. */
+typedef enum DynArrayGrowth {
+	DynArrayGrowth_Default,    /**< Grow by half of the current capacity. */
+	DynArrayGrowth_PowerOfTwo, /**< Grow to the next power of two, trading memory for fewer reallocations. */
+	DynArrayGrowth_Exact,      /**< Grow only as much as needed, for arrays which are filled once. */
+} DynArrayGrowth;
+
 // ===== Internal function implementations =====
 
 /**
  * Create a dynamic array. Users should use the helper macro DynArray_Create() instead of this function directly.
- * @param elementSize The size of each element, in bytes.
+ * @param elementSize The size of each element, in bytes. Must fit in 32 bits.
  * @param elementCapacity The amount of elements the dynamic array will be able to hold without resizing.
  * @return NULL upon allocation failure, otherwise a pointer to the created dynamic array.
  * @sa DynArray_Create(), DynArray_CreateWithCapacity()
  */
 OAPI void* _DynArray_Create(U64 elementSize, U64 elementCapacity);
 
+/**
+ * Create a dynamic array backed by virtual memory. Address space for the maximum number of elements is reserved up
+ * front, and memory is committed as the array grows. The array never moves, so growth does not copy the elements and
+ * pointers into the array stay valid. Users should use the helper macro DynArray_CreateVirtual() instead of this
+ * function directly.
+ * @param elementSize The size of each element, in bytes. Must fit in 32 bits.
+ * @param maxElementCount The maximum number of elements the dynamic array will be able to hold. Must not be 0.
+ * @return NULL upon allocation failure, otherwise a pointer to the created dynamic array.
+ * @sa DynArray_CreateVirtual()
+ */
+OAPI void* _DynArray_CreateVirtual(U64 elementSize, U64 maxElementCount);
+
+/**
+ * Create a dynamic array on the calling thread's scratch allocator. The array may only be used inside the current
+ * scratch scope, and its memory is released by Memory_ScratchEnd() rather than _DynArray_Destroy(). Users should use
+ * the helper macro DynArray_CreateScratch() instead of this function directly.
+ * @param elementSize The size of each element, in bytes. Must fit in 32 bits.
+ * @param elementCapacity The amount of elements the dynamic array will be able to hold without resizing.
+ * @return NULL upon allocation failure, otherwise a pointer to the created dynamic array.
+ * @sa DynArray_CreateScratch(), DynArray_CreateScratchWithSize(), Memory_ScratchBegin()
+ */
+OAPI void* _DynArray_CreateScratch(U64 elementSize, U64 elementCapacity);
+
+/**
+ * Create a dynamic array on the calling thread's scratch allocator with a predetermined size. Users should use the
+ * helper macro DynArray_CreateScratchWithSize() instead of this function directly.
+ * @param elementSize The size of each element, in bytes. Must fit in 32 bits.
+ * @param elementCount The amount of elements the dynamic array will hold.
+ * @return NULL upon allocation failure, otherwise a pointer to the created dynamic array.
+ * @sa DynArray_CreateScratch(), DynArray_CreateScratchWithSize(), Memory_ScratchBegin()
+ */
+OAPI void* _DynArray_CreateScratchSized(U64 elementSize, U64 elementCount);
+
+/**
+ * Create a dynamic array inside caller-provided storage, such as a local variable or a struct member declared with
+ * DynArray_InlineStorage(). No memory is allocated until the array outgrows its storage, at which point it moves to
+ * the heap and must be destroyed as usual. The storage must outlive the array, and must not be moved or copied while
+ * the array is using it. Users should use the helper macro DynArray_CreateInline() instead of this function directly.
+ * @param elementSize The size of each element, in bytes. Must fit in 32 bits.
+ * @param storage The storage to place the array in. Must be aligned to 16 bytes.
+ * @param storageSize The size of the storage, in bytes.
+ * @return A pointer to the created dynamic array.
+ * @sa DynArray_InlineStorage(), DynArray_CreateInline()
+ */
+OAPI void* _DynArray_CreateInline(U64 elementSize, void* storage, U64 storageSize);
+
 /**
  * Create a dynamic array with a predetermined size. Users should use the helper macro DynArray_CreateWithSize() instead
  * of this function directly.
- * @param elementSize The size of each element, in bytes.
+ * @param elementSize The size of each element, in bytes. Must fit in 32 bits.
  * @param elementCount The amount of elements the dynamic array will hold.
  * @return NULL upon allocation failure, otherwise a pointer to the created dynamic array.
  * @sa DynArray_Create(), DynArray_CreateWithCapacity()
@@ -31,7 +87,8 @@ OAPI void* _DynArray_Create(U64 elementSize, U64 elementCapacity);
 OAPI void* _DynArray_CreateSized(U64 elementSize, U64 elementCount);
 
 /**
- * Destroys a dynamic array.
+ * Destroys a dynamic array. Destroying a scratch array does nothing, as its memory belongs to the scratch scope, and
+ * neither does destroying an inline array which has not outgrown its storage.
  * @param dynArray The dynamic array to destroy.
  */
 OAPI void _DynArray_Destroy(DynArrayT dynArray);
@@ -58,7 +115,15 @@ OAPI U64 _DynArray_Size(ConstDynArrayT dynArray);
 OAPI U64 _DynArray_Stride(ConstDynArrayT dynArray);
 
 /**
- * Trim the dynamic array, removing any excess capacity.
+ * Set how the dynamic array grows when it runs out of capacity. Arrays use DynArrayGrowth_Default until this is called.
+ * @param dynArray A pointer to the dynamic array.
+ * @param growth The growth policy to use.
+ */
+OAPI void _DynArray_SetGrowth(DynArrayT dynArray, DynArrayGrowth growth);
+
+/**
+ * Trim the dynamic array, removing any excess capacity. Dynamic arrays backed by virtual memory stay in place, and
+ * return their unused pages to the operating system.
  * @param dynArray A pointer to the dynamic array.
  * @return TRUE upon successful trim, FALSE otherwise.
  */
@@ -84,8 +149,18 @@ OAPI B8 _DynArray_Reserve(DynArrayT dynArray, U64 elementCount);
  * Append the given element to the end of the dynamic array.
  * @param dynArray A pointer to the dynamic array to resize.
  * @param element A pointer to the element to append.
+ * @return TRUE upon success, FALSE if the dynamic array failed to grow.
+ */
+OAPI B8 _DynArray_Push(DynArrayT dynArray, const void* element);
+
+/**
+ * Append the given elements to the end of the dynamic array. The array grows at most once for the whole batch.
+ * @param dynArray A pointer to the dynamic array.
+ * @param elements A pointer to the elements to append. They must not point into the dynamic array itself.
+ * @param count The number of elements to append.
+ * @return TRUE upon success, FALSE if the dynamic array failed to grow.
  */
-OAPI void _DynArray_Push(DynArrayT dynArray, const void* element);
+OAPI B8 _DynArray_PushMany(DynArrayT dynArray, const void* elements, U64 count);
 
 /**
  * Pop the element from the end of the dynamic array.
@@ -99,8 +174,19 @@ OAPI void _DynArray_Pop(DynArrayT dynArray, void* element);
  * @param dynArray A pointer to the dynamic array.
  * @param index The index to insert the element into.
  * @param element A pointer to the element to insert.
+ * @return TRUE upon success, FALSE if the dynamic array failed to grow.
  */
-OAPI void _DynArray_Insert(DynArrayT dynArray, U64 index, const void* element);
+OAPI B8 _DynArray_Insert(DynArrayT dynArray, U64 index, const void* element);
+
+/**
+ * Insert the given elements at the specified index, shifting the existing elements once for the whole batch.
+ * @param dynArray A pointer to the dynamic array.
+ * @param index The index to insert the first element into.
+ * @param elements A pointer to the elements to insert. They must not point into the dynamic array itself.
+ * @param count The number of elements to insert.
+ * @return TRUE upon success, FALSE if the dynamic array failed to grow.
+ */
+OAPI B8 _DynArray_InsertRange(DynArrayT dynArray, U64 index, const void* elements, U64 count);
 
 /**
  * Extract the element at the specified index and remove it from the array.
@@ -110,6 +196,24 @@ OAPI void _DynArray_Insert(DynArrayT dynArray, U64 index, const void* element);
  */
 OAPI void _DynArray_Extract(DynArrayT dynArray, U64 index, void* element);
 
+/**
+ * Extract a range of elements starting at the specified index and remove them from the array.
+ * @param dynArray A pointer to the dynamic array.
+ * @param index The index of the first element to extract.
+ * @param count The number of elements to extract. Extracting 0 elements does nothing, even from an empty array.
+ * @param[out] elements A pointer to where the extracted elements will be placed, or NULL.
+ */
+OAPI void _DynArray_ExtractRange(DynArrayT dynArray, U64 index, U64 count, void* elements);
+
+/**
+ * Remove the element at the specified index by moving the last element into its place. This does not preserve the
+ * order of the elements, but does not need to shift the rest of the array.
+ * @param dynArray A pointer to the dynamic array.
+ * @param index The index to remove.
+ * @param[out] element A pointer to where the removed element will be placed, or NULL.
+ */
+OAPI void _DynArray_SwapRemove(DynArrayT dynArray, U64 index, void* element);
+
 // ===== User-facing macro implementations =====
 
 /**
@@ -127,6 +231,50 @@ OAPI void _DynArray_Extract(DynArrayT dynArray, U64 index, void* element);
  */
 #define DynArray_CreateWithCapacity(type, count) _DynArray_Create(sizeof(type), count)
 
+/**
+ * Create a dynamic array backed by virtual memory, which grows in place without copying.
+ * @param type The type the dynamic array will contain.
+ * @param maxCount The maximum amount of elements the dynamic array will be able to hold.
+ * @return The newly created dynamic array.
+ */
+#define DynArray_CreateVirtual(type, maxCount) _DynArray_CreateVirtual(sizeof(type), maxCount)
+
+/**
+ * Create a dynamic array on the calling thread's scratch allocator, which is released at the end of the scratch scope.
+ * @param type The type the dynamic array will contain.
+ * @param count The amount of elements the dynamic array will be able to hold without resizing.
+ * @return The newly created dynamic array.
+ */
+#define DynArray_CreateScratch(type, count) _DynArray_CreateScratch(sizeof(type), count)
+
+/**
+ * Create a dynamic array on the calling thread's scratch allocator with a specified size.
+ * @param type The type the dynamic array will contain.
+ * @param count The amount of elements the dynamic array will hold.
+ * @return The newly created dynamic array.
+ */
+#define DynArray_CreateScratchWithSize(type, count) _DynArray_CreateScratchSized(sizeof(type), count)
+
+/**
+ * Declare storage for an inline dynamic array, to be used as the type of a local variable or struct member.
+ * @param type The type the dynamic array will contain.
+ * @param count The amount of elements the storage will be able to hold.
+ */
+#define DynArray_InlineStorage(type, count)         \
+	struct {                                          \
+		_Alignas(16) U8 _Header[DYNARRAY_HEADER_SIZE]; \
+		type _Elements[count];                          \
+	}
+
+/**
+ * Create a dynamic array inside storage declared with DynArray_InlineStorage(), which only spills to the heap once it
+ * holds more elements than the storage does.
+ * @param type The type the dynamic array will contain.
+ * @param storage The storage variable to place the array in.
+ * @return The newly created dynamic array.
+ */
+#define DynArray_CreateInline(type, storage) _DynArray_CreateInline(sizeof(type), &(storage), sizeof(storage))
+
 /**
  * Create a dynamic array with a specified size.
  * @param type The type the dynamic array will contain.
@@ -147,6 +295,9 @@ OAPI void _DynArray_Extract(DynArrayT dynArray, U64 index, void* element);
 /** Convenience macro for _DynArray_Stride(). */
 #define DynArray_Stride(dynArray) _DynArray_Stride((ConstDynArrayT) dynArray)
 
+/** Convenience macro for _DynArray_SetGrowth(). */
+#define DynArray_SetGrowth(dynArray, growth) _DynArray_SetGrowth((DynArrayT) dynArray, growth)
+
 /** Convenience macro for _DynArray_Trim(). */
 #define DynArray_Trim(dynArray) _DynArray_Trim((DynArrayT) dynArray)
 
@@ -166,6 +317,10 @@ OAPI void _DynArray_Extract(DynArrayT dynArray, U64 index, void* element);
 		_DynArray_Push((DynArrayT) dynArray, (const void*) &_daTemp); \
 	} while (0)
 
+/** Convenience macro for _DynArray_PushMany(). */
+#define DynArray_PushMany(dynArray, elements, count) \
+	_DynArray_PushMany((DynArrayT) dynArray, (const void*) elements, count)
+
 /** Convenience macro for _DynArray_Insert(). */
 #define DynArray_Insert(dynArray, index, element) _DynArray_Insert((DynArrayT) dynArray, index, (const void*) &element)
 
@@ -176,8 +331,19 @@ OAPI void _DynArray_Extract(DynArrayT dynArray, U64 index, void* element);
 		_DynArray_Insert((DynArrayT) dynArray, index, (const void*) &_daTemp); \
 	} while (0)
 
+/** Convenience macro for _DynArray_InsertRange(). */
+#define DynArray_InsertRange(dynArray, index, elements, count) \
+	_DynArray_InsertRange((DynArrayT) dynArray, index, (const void*) elements, count)
+
 /** Convenience macro for _DynArray_Pop(). */
 #define DynArray_Pop(dynArray, element) _DynArray_Pop((DynArrayT) dynArray, (void*) element)
 
 /** Convenience macro for _DynArray_Extract(). */
 #define DynArray_Extract(dynArray, index, element) _DynArray_Extract((DynArrayT) dynArray, index, (void*) element)
+
+/** Convenience macro for _DynArray_ExtractRange(). */
+#define DynArray_ExtractRange(dynArray, index, count, elements) \
+	_DynArray_ExtractRange((DynArrayT) dynArray, index, count, (void*) elements)
+
+/** Convenience macro for _DynArray_SwapRemove(). */
+#define DynArray_SwapRemove(dynArray, index, element) _DynArray_SwapRemove((DynArrayT) dynArray, index, (void*) element)
@@ -0,0 +1,79 @@
+/** @file
+ *  @brief Intrusive free list, keeping unused structs on a stack linked through a node embedded in each of them */
+#pragma once
+
+#include <Obsidian/Defines.h>
+
+/**
+ * The link of a free list element. Structs which go on a free list embed a FreeListNode, which is only used while the
+ * struct is unused, so it can share storage with the struct's other members through a union.
+ */
+typedef struct FreeListNode {
+	struct FreeListNode* Next; /**< The next node on the free list. */
+} FreeListNode;
+
+/**
+ * A last-in, first-out stack of unused elements. Elements are handed out in the reverse order they were returned, so
+ * the most recently used, and most likely cached, element is reused first.
+ */
+typedef struct FreeList {
+	FreeListNode* Head; /**< The most recently pushed node, or NULL if the list is empty. */
+	U64 Count;          /**< Number of nodes on the list. */
+} FreeList;
+
+/**
+ * Initialize an empty free list.
+ * @param list The free list to initialize.
+ */
+OAPI void FreeList_Initialize(FreeList* list);
+
+/**
+ * Determine whether a free list has no elements.
+ * @param list The free list.
+ * @return TRUE if the free list is empty, FALSE otherwise.
+ */
+OAPI B8 FreeList_IsEmpty(const FreeList* list);
+
+/**
+ * Get the number of elements on a free list.
+ * @param list The free list.
+ * @return The number of elements on the free list.
+ */
+OAPI U64 FreeList_Count(const FreeList* list);
+
+/**
+ * Add an element to a free list.
+ * @param list The free list.
+ * @param node The node of the element to add, which must not already be on a free list.
+ */
+OAPI void FreeList_Push(FreeList* list, FreeListNode* node);
+
+/**
+ * Take the most recently added element from a free list.
+ * @param list The free list.
+ * @return The node of the removed element, or NULL if the free list was empty.
+ */
+OAPI FreeListNode* FreeList_Pop(FreeList* list);
+
+/**
+ * Add every element of an array to a free list, such that they will be popped in order from the first element.
+ * @param list The free list.
+ * @param elements A pointer to the first element of the array.
+ * @param stride The size of each element, in bytes.
+ * @param count The number of elements in the array.
+ * @param nodeOffset The offset of the FreeListNode within each element, in bytes.
+ */
+OAPI void FreeList_PushArray(FreeList* list, void* elements, size_t stride, U64 count, size_t nodeOffset);
+
+/**
+ * Get the struct which a free list node is embedded in.
+ * @param node A pointer to the node.
+ * @param type The type of the struct the node is embedded in.
+ * @param member The name of the node's member within the struct.
+ * @return A pointer to the struct.
+ */
+#define FreeList_Entry(node, type, member) ((type*) (((U8*) (node)) - offsetof(type, member)))
+
+/** Convenience macro for FreeList_PushArray(), for a C array of structs. */
+#define FreeList_PushStructArray(list, array, count, member) \
+	FreeList_PushArray(list, array, sizeof(*(array)), count, offsetof(typeof(*(array)), member))
@@ -0,0 +1,159 @@
+/** @file
+ *  @brief Intrusive doubly-linked list, linking structs through a node embedded in each of them */
+#pragma once
+
+#include <Obsidian/Defines.h>
+
+/**
+ * The links of a list element. Structs which go in a list embed a ListNode, and the list links those nodes together
+ * without ever allocating. A struct can be in several lists at once by embedding a node for each of them.
+ */
+typedef struct ListNode {
+	struct ListNode* Next; /**< The next node in the list, or NULL if the node is not in a list. */
+	struct ListNode* Prev; /**< The previous node in the list, or NULL if the node is not in a list. */
+} ListNode;
+
+/**
+ * A doubly-linked list of nodes. The list is circular through its head node, which is not an element itself, so
+ * adding and removing nodes never needs to special-case the ends of the list. Lists must not be moved or copied while
+ * they have elements, as the first and last elements point back at the head.
+ */
+typedef struct List {
+	ListNode Head; /**< Head of the list. Head.Next is the first element, and Head.Prev is the last. */
+} List;
+
+/**
+ * Initialize an empty list.
+ * @param list The list to initialize.
+ */
+OAPI void List_Initialize(List* list);
+
+/**
+ * Initialize a node which is not in any list, so that ListNode_IsLinked() can be used on it.
+ * @param node The node to initialize.
+ */
+OAPI void ListNode_Initialize(ListNode* node);
+
+/**
+ * Determine whether a node is in a list.
+ * @param node The node, which must have been initialized or removed from a list.
+ * @return TRUE if the node is in a list, FALSE otherwise.
+ */
+OAPI B8 ListNode_IsLinked(const ListNode* node);
+
+/**
+ * Determine whether a list has no elements.
+ * @param list The list.
+ * @return TRUE if the list is empty, FALSE otherwise.
+ */
+OAPI B8 List_IsEmpty(const List* list);
+
+/**
+ * Get the first element of a list.
+ * @param list The list.
+ * @return The first node of the list, or NULL if it is empty.
+ */
+OAPI ListNode* List_Front(const List* list);
+
+/**
+ * Get the last element of a list.
+ * @param list The list.
+ * @return The last node of the list, or NULL if it is empty.
+ */
+OAPI ListNode* List_Back(const List* list);
+
+/**
+ * Add a node to the start of a list.
+ * @param list The list.
+ * @param node The node to add, which must not already be in a list.
+ */
+OAPI void List_PushFront(List* list, ListNode* node);
+
+/**
+ * Add a node to the end of a list.
+ * @param list The list.
+ * @param node The node to add, which must not already be in a list.
+ */
+OAPI void List_PushBack(List* list, ListNode* node);
+
+/**
+ * Add a node directly before another node.
+ * @param position The node to insert before, which must be in a list.
+ * @param node The node to add, which must not already be in a list.
+ */
+OAPI void List_InsertBefore(ListNode* position, ListNode* node);
+
+/**
+ * Add a node directly after another node.
+ * @param position The node to insert after, which must be in a list.
+ * @param node The node to add, which must not already be in a list.
+ */
+OAPI void List_InsertAfter(ListNode* position, ListNode* node);
+
+/**
+ * Remove a node from whichever list it is in. This does not need the list, and takes constant time.
+ * @param node The node to remove, which must be in a list.
+ */
+OAPI void List_Remove(ListNode* node);
+
+/**
+ * Remove the first element of a list.
+ * @param list The list.
+ * @return The removed node, or NULL if the list was empty.
+ */
+OAPI ListNode* List_PopFront(List* list);
+
+/**
+ * Remove the last element of a list.
+ * @param list The list.
+ * @return The removed node, or NULL if the list was empty.
+ */
+OAPI ListNode* List_PopBack(List* list);
+
+/**
+ * Move a node to the start of a list, such as when an entry of a least-recently-used cache is used again.
+ * @param list The list to move the node to.
+ * @param node The node to move, which must be in a list, but not necessarily the same one.
+ */
+OAPI void List_MoveToFront(List* list, ListNode* node);
+
+/**
+ * Move a node to the end of a list.
+ * @param list The list to move the node to.
+ * @param node The node to move, which must be in a list, but not necessarily the same one.
+ */
+OAPI void List_MoveToBack(List* list, ListNode* node);
+
+/**
+ * Move every element of one list to the end of another in constant time, leaving the source list empty. This lets a
+ * whole batch of elements be handed over at once, such as a frame's worth of resources pending destruction.
+ * @param dst The list to add the elements to.
+ * @param src The list to take the elements from.
+ */
+OAPI void List_Append(List* dst, List* src);
+
+/**
+ * Get the struct which a list node is embedded in.
+ * @param node A pointer to the node.
+ * @param type The type of the struct the node is embedded in.
+ * @param member The name of the node's member within the struct.
+ * @return A pointer to the struct.
+ */
+#define List_Entry(node, type, member) ((type*) (((U8*) (node)) - offsetof(type, member)))
+
+/**
+ * Iterate over every node of a list, from first to last. The current node must not be removed during iteration; use
+ * List_ForEachSafe() for that.
+ * @param node The name of the ListNode* variable to declare for the current node.
+ * @param list A pointer to the list.
+ */
+#define List_ForEach(node, list) for (ListNode* node = (list)->Head.Next; node != &(list)->Head; node = node->Next)
+
+/**
+ * Iterate over every node of a list, from first to last, allowing the current node to be removed during iteration.
+ * @param node The name of the ListNode* variable to declare for the current node.
+ * @param list A pointer to the list.
+ */
+#define List_ForEachSafe(node, list)                                                           \
+	for (ListNode *node = (list)->Head.Next, *node##Next = node->Next; node != &(list)->Head; \
+	     node = node##Next, node##Next = node->Next)
@@ -0,0 +1,107 @@
+/** @file
+ *  @brief Bounded lock-free ring queues, for handing data between threads */
+#pragma once
+
+#include <Obsidian/Defines.h>
+
+/**
+ * A bounded queue for a single producer thread and a single consumer thread. Pushing and popping are wait-free.
+ * Elements are copied in and out of the queue.
+ */
+typedef struct SpscQueueT* SpscQueue;
+
+/**
+ * A bounded queue which any number of threads may push to and pop from at once. Each slot carries a sequence counter,
+ * so threads only contend on the head or tail index. Elements are copied in and out of the queue.
+ */
+typedef struct MpmcQueueT* MpmcQueue;
+
+/**
+ * Create a single-producer, single-consumer queue.
+ * @param elementSize The size of each element, in bytes.
+ * @param capacity The number of elements the queue can hold. Rounded up to a power of two.
+ * @return NULL upon allocation failure, otherwise the created queue.
+ * @sa SpscQueue_Destroy()
+ */
+OAPI SpscQueue SpscQueue_Create(U64 elementSize, U64 capacity);
+
+/**
+ * Destroy a single-producer, single-consumer queue. No thread may be using the queue.
+ * @param queue The queue to destroy.
+ */
+OAPI void SpscQueue_Destroy(SpscQueue queue);
+
+/**
+ * Push an element onto the back of the queue. Must only be called from the producer thread.
+ * @param queue The queue to push to.
+ * @param element A pointer to the element to copy into the queue.
+ * @return TRUE if the element was pushed, FALSE if the queue is full.
+ */
+OAPI B8 SpscQueue_Push(SpscQueue queue, const void* element);
+
+/**
+ * Pop the element at the front of the queue. Must only be called from the consumer thread.
+ * @param queue The queue to pop from.
+ * @param[out] element A pointer to where the popped element will be placed.
+ * @return TRUE if an element was popped, FALSE if the queue is empty.
+ */
+OAPI B8 SpscQueue_Pop(SpscQueue queue, void* element);
+
+/**
+ * Get the number of elements in the queue. This is only a snapshot if other threads are using the queue.
+ * @param queue The queue.
+ * @return The number of elements in the queue.
+ */
+OAPI U64 SpscQueue_Size(SpscQueue queue);
+
+/**
+ * Get the number of elements the queue can hold.
+ * @param queue The queue.
+ * @return The capacity of the queue.
+ */
+OAPI U64 SpscQueue_Capacity(SpscQueue queue);
+
+/**
+ * Create a multi-producer, multi-consumer queue.
+ * @param elementSize The size of each element, in bytes.
+ * @param capacity The number of elements the queue can hold. Rounded up to a power of two, and at least 2.
+ * @return NULL upon allocation failure, otherwise the created queue.
+ * @sa MpmcQueue_Destroy()
+ */
+OAPI MpmcQueue MpmcQueue_Create(U64 elementSize, U64 capacity);
+
+/**
+ * Destroy a multi-producer, multi-consumer queue. No thread may be using the queue.
+ * @param queue The queue to destroy.
+ */
+OAPI void MpmcQueue_Destroy(MpmcQueue queue);
+
+/**
+ * Push an element onto the back of the queue. May be called from any thread.
+ * @param queue The queue to push to.
+ * @param element A pointer to the element to copy into the queue.
+ * @return TRUE if the element was pushed, FALSE if the queue is full.
+ */
+OAPI B8 MpmcQueue_Push(MpmcQueue queue, const void* element);
+
+/**
+ * Pop the element at the front of the queue. May be called from any thread.
+ * @param queue The queue to pop from.
+ * @param[out] element A pointer to where the popped element will be placed.
+ * @return TRUE if an element was popped, FALSE if the queue is empty.
+ */
+OAPI B8 MpmcQueue_Pop(MpmcQueue queue, void* element);
+
+/**
+ * Get the number of elements in the queue. This is only a snapshot if other threads are using the queue.
+ * @param queue The queue.
+ * @return The number of elements in the queue.
+ */
+OAPI U64 MpmcQueue_Size(MpmcQueue queue);
+
+/**
+ * Get the number of elements the queue can hold.
+ * @param queue The queue.
+ * @return The capacity of the queue.
+ */
+OAPI U64 MpmcQueue_Capacity(MpmcQueue queue);
@@ -0,0 +1,151 @@
+/** @file
+ *  @brief Slot map container, giving out generational handles to densely-stored values */
+#pragma once
+
+#include <Obsidian/Defines.h>
+
+static const U32 SlotMap_DefaultCapacity = 16;
+
+typedef void** SlotMapT;
+typedef const void* const* ConstSlotMapT;
+
+/**
+ * A reference to a value in a slot map. A handle stays valid until its value is removed, however many other values are
+ * inserted or removed, and is then rejected by every lookup rather than referring to whatever reuses its slot.
+ */
+typedef struct SlotMapHandle {
+	U32 Index;      /**< The slot the value was given. */
+	U32 Generation; /**< How many times the slot had been used when the handle was given out. Never 0 for a value. */
+} SlotMapHandle;
+
+/** A handle which never refers to a value. Zero-initialized handles are null. */
+static const SlotMapHandle SlotMap_NullHandle = {0, 0};
+
+// ===== Internal function implementations =====
+
+/**
+ * Create a slot map. The slot map is a pointer to its values, which are stored densely so that it can be iterated like
+ * a normal array of values, up to _SlotMap_Size(). Removing a value moves the last value into its place, so pointers
+ * into the slot map are only valid until the next insertion or removal; handles should be kept instead. Users should
+ * use one of the helper macros such as SlotMap_Create() instead of this function directly.
+ * @param elementSize The size of each value, in bytes. Must fit in 32 bits.
+ * @param capacity The amount of values the slot map will be able to hold without growing.
+ * @return NULL upon allocation failure, otherwise a pointer to the created slot map.
+ * @sa SlotMap_Create(), SlotMap_CreateWithCapacity()
+ */
+OAPI void* _SlotMap_Create(U64 elementSize, U64 capacity);
+
+/**
+ * Destroys a slot map.
+ * @param map The slot map to destroy.
+ */
+OAPI void _SlotMap_Destroy(SlotMapT map);
+
+/**
+ * Get the number of values in the slot map.
+ * @param map A pointer to the slot map.
+ * @return The number of values in the slot map.
+ */
+OAPI U64 _SlotMap_Size(ConstSlotMapT map);
+
+/**
+ * Get the number of values the slot map can hold without growing.
+ * @param map A pointer to the slot map.
+ * @return The capacity of the slot map.
+ */
+OAPI U64 _SlotMap_Capacity(ConstSlotMapT map);
+
+/**
+ * Ensure the slot map can hold the given number of values without growing.
+ * @param map A pointer to the slot map.
+ * @param count The number of values to reserve space for.
+ * @return TRUE upon successful reserve, FALSE upon failure.
+ */
+OAPI B8 _SlotMap_Reserve(SlotMapT map, U64 count);
+
+/**
+ * Insert a value into the slot map. The value must not point into the slot map itself.
+ * @param map A pointer to the slot map.
+ * @param value A pointer to the value, or NULL to zero-initialize it.
+ * @return The handle of the new value, or SlotMap_NullHandle upon allocation failure.
+ */
+OAPI SlotMapHandle _SlotMap_Insert(SlotMapT map, const void* value);
+
+/**
+ * Find the value a handle refers to.
+ * @param map A pointer to the slot map.
+ * @param handle The handle to look up.
+ * @return NULL if the handle is null or its value has been removed, otherwise a pointer to the value within the slot
+ * map.
+ */
+OAPI void* _SlotMap_Get(ConstSlotMapT map, SlotMapHandle handle);
+
+/**
+ * Remove the value a handle refers to from the slot map. The handle, and every copy of it, becomes invalid.
+ * @param map A pointer to the slot map.
+ * @param handle The handle of the value to remove.
+ * @param[out] value A pointer to where the removed value will be placed, or NULL.
+ * @return TRUE if the value was removed, FALSE if the handle was already invalid.
+ */
+OAPI B8 _SlotMap_Remove(SlotMapT map, SlotMapHandle handle, void* value);
+
+/**
+ * Get the handle of the value at a position in the slot map's dense storage, to find handles while iterating.
+ * @param map A pointer to the slot map.
+ * @param index The position of the value, less than _SlotMap_Size().
+ * @return The handle of the value.
+ */
+OAPI SlotMapHandle _SlotMap_HandleAt(ConstSlotMapT map, U64 index);
+
+/**
+ * Remove every value from the slot map, keeping its capacity. Every handle given out so far becomes invalid.
+ * @param map A pointer to the slot map.
+ */
+OAPI void _SlotMap_Clear(SlotMapT map);
+
+// ===== User-facing macro implementations =====
+
+/**
+ * Create a slot map.
+ * @param type The type of the slot map's values.
+ * @return The newly created slot map.
+ */
+#define SlotMap_Create(type) _SlotMap_Create(sizeof(type), SlotMap_DefaultCapacity)
+
+/**
+ * Create a slot map with a specified capacity.
+ * @param type The type of the slot map's values.
+ * @param count The amount of values the slot map will be able to hold without growing.
+ * @return The newly created slot map.
+ */
+#define SlotMap_CreateWithCapacity(type, count) _SlotMap_Create(sizeof(type), count)
+
+/** Convenience macro for _SlotMap_Destroy(). */
+#define SlotMap_Destroy(map) _SlotMap_Destroy((SlotMapT) map)
+
+/** Convenience macro for _SlotMap_Size(). */
+#define SlotMap_Size(map) _SlotMap_Size((ConstSlotMapT) map)
+
+/** Convenience macro for _SlotMap_Capacity(). */
+#define SlotMap_Capacity(map) _SlotMap_Capacity((ConstSlotMapT) map)
+
+/** Convenience macro for _SlotMap_Reserve(). */
+#define SlotMap_Reserve(map, count) _SlotMap_Reserve((SlotMapT) map, count)
+
+/** Convenience macro for _SlotMap_Insert(). */
+#define SlotMap_Insert(map, value) _SlotMap_Insert((SlotMapT) map, (const void*) &value)
+
+/** Convenience macro for _SlotMap_Get(). */
+#define SlotMap_Get(map, handle) _SlotMap_Get((ConstSlotMapT) map, handle)
+
+/** Determine whether a handle still refers to a value in the slot map. */
+#define SlotMap_IsValid(map, handle) (_SlotMap_Get((ConstSlotMapT) map, handle) != NULL)
+
+/** Convenience macro for _SlotMap_Remove(). */
+#define SlotMap_Remove(map, handle, value) _SlotMap_Remove((SlotMapT) map, handle, (void*) value)
+
+/** Convenience macro for _SlotMap_HandleAt(). */
+#define SlotMap_HandleAt(map, index) _SlotMap_HandleAt((ConstSlotMapT) map, index)
+
+/** Convenience macro for _SlotMap_Clear(). */
+#define SlotMap_Clear(map) _SlotMap_Clear((SlotMapT) map)
@@ -0,0 +1,94 @@
+/** @file
+ *  @brief Sorting routines for arrays, including DynArray contents */
+#pragma once
+
+#include <Obsidian/Containers/DynArray.h>
+#include <Obsidian/Defines.h>
+
+/**
+ * Compare two elements.
+ * @param a A pointer to the first element.
+ * @param b A pointer to the second element.
+ * @return A negative number if a sorts before b, a positive number if a sorts after b, or 0 if they are equal.
+ */
+typedef I32 (*SortCompareFn)(const void* a, const void* b);
+
+/**
+ * Sort an array of U32 keys in ascending order, along with an array of U32 values such as the indices of the elements
+ * the keys belong to. The sort is a stable least-significant-digit radix sort, taking linear time. Keys and values
+ * can be the contents of a DynArray, as its handle points directly at its elements.
+ * @param keys The keys to sort.
+ * @param values The values to move along with their keys, or NULL to sort only the keys.
+ * @param count The number of keys.
+ * @param scratch A buffer of at least Sort_RadixScratchSize(U32, count) bytes to sort through, which can be kept and
+ * reused between sorts, or NULL to use the calling thread's scratch allocator.
+ * @return TRUE on success, FALSE if scratch memory could not be allocated, in which case the arrays are unchanged.
+ */
+OAPI B8 Sort_RadixU32(U32* keys, U32* values, U64 count, void* scratch);
+
+/**
+ * Sort an array of U64 keys in ascending order, along with an array of U32 values. The sort is stable.
+ * @param keys The keys to sort.
+ * @param values The values to move along with their keys, or NULL to sort only the keys.
+ * @param count The number of keys.
+ * @param scratch A buffer of at least Sort_RadixScratchSize(U64, count) bytes to sort through, which can be kept and
+ * reused between sorts, or NULL to use the calling thread's scratch allocator.
+ * @return TRUE on success, FALSE if scratch memory could not be allocated, in which case the arrays are unchanged.
+ * @sa Sort_RadixU32()
+ */
+OAPI B8 Sort_RadixU64(U64* keys, U32* values, U64 count, void* scratch);
+
+/**
+ * Sort an array of U32 keys and their values across several threads. The keys are first split into buckets by the
+ * highest 8-bit digit in which any of them differ, and the buckets are then radix sorted independently. Arrays too
+ * small to be worth starting threads for are sorted on the calling thread. The sort is stable.
+ * @param keys The keys to sort.
+ * @param values The values to move along with their keys, or NULL to sort only the keys.
+ * @param count The number of keys.
+ * @param threadCount The number of threads to sort with, including the calling thread, or 0 for one per processor.
+ * @param scratch A buffer of at least Sort_RadixScratchSize(U32, count) bytes to sort through, or NULL to allocate one.
+ * @return TRUE on success, FALSE if memory could not be allocated, in which case the arrays are unchanged.
+ */
+OAPI B8 Sort_RadixParallelU32(U32* keys, U32* values, U64 count, U32 threadCount, void* scratch);
+
+/**
+ * Sort an array of U64 keys and their values across several threads. The sort is stable.
+ * @param keys The keys to sort.
+ * @param values The values to move along with their keys, or NULL to sort only the keys.
+ * @param count The number of keys.
+ * @param threadCount The number of threads to sort with, including the calling thread, or 0 for one per processor.
+ * @param scratch A buffer of at least Sort_RadixScratchSize(U64, count) bytes to sort through, or NULL to allocate one.
+ * @return TRUE on success, FALSE if memory could not be allocated, in which case the arrays are unchanged.
+ * @sa Sort_RadixParallelU32()
+ */
+OAPI B8 Sort_RadixParallelU64(U64* keys, U32* values, U64 count, U32 threadCount, void* scratch);
+
+/**
+ * Sort an array of elements of any type with a comparison function, for elements which have no integer key. The sort
+ * is a stable merge sort, taking O(n log n) time.
+ * @param elements The elements to sort.
+ * @param count The number of elements.
+ * @param stride The size of each element, in bytes.
+ * @param compare The function used to compare elements.
+ * @param scratch A buffer of at least count * stride bytes to sort through, or NULL to use the calling thread's scratch
+ * allocator.
+ * @return TRUE on success, FALSE if scratch memory could not be allocated, in which case the array is unchanged.
+ */
+OAPI B8 Sort_Stable(void* elements, U64 count, U64 stride, SortCompareFn compare, void* scratch);
+
+/**
+ * Get the size of the scratch buffer needed to radix sort an array.
+ * @param keyType The type of the keys, U32 or U64.
+ * @param count The number of keys.
+ * @return The size of the scratch buffer, in bytes.
+ */
+#define Sort_RadixScratchSize(keyType, count) ((count) * (sizeof(keyType) + sizeof(U32)))
+
+/**
+ * Sort the contents of a DynArray with a comparison function.
+ * @param dynArray A pointer to the DynArray.
+ * @param compareFn The function used to compare elements.
+ * @return TRUE on success, FALSE if scratch memory could not be allocated.
+ */
+#define Sort_DynArray(dynArray, compareFn) \
+	Sort_Stable(*(dynArray), DynArray_Size(dynArray), DynArray_Stride(dynArray), compareFn, NULL)
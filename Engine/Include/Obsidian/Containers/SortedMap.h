@@ -0,0 +1,209 @@
+/** @file
+ *  @brief Sorted flat map container, keeping entries ordered by key in contiguous arrays */
+#pragma once
+
+#include <Obsidian/Defines.h>
+
+static const U32 SortedMap_DefaultCapacity = 16;
+
+typedef void** SortedMapT;
+typedef const void* const* ConstSortedMapT;
+
+// ===== Internal function implementations =====
+
+/**
+ * Create a sorted map. The map is a pointer to its values, which are stored in ascending order of their U64 keys, so
+ * entries can be iterated in order like a normal array of values up to _SortedMap_Size(). Keys are kept in their own
+ * array, so lookups only touch keys until they find their entry. Inserting and removing entries moves every entry after
+ * them, so maps which change often should be built in bulk with _SortedMap_Build() where possible. Users should use one
+ * of the helper macros such as SortedMap_Create() instead of this function directly.
+ * @param valueSize The size of each value, in bytes. Must fit in 32 bits.
+ * @param capacity The amount of entries the map will be able to hold without growing.
+ * @return NULL upon allocation failure, otherwise a pointer to the created map.
+ * @sa SortedMap_Create(), SortedMap_CreateWithCapacity()
+ */
+OAPI void* _SortedMap_Create(U64 valueSize, U64 capacity);
+
+/**
+ * Destroys a sorted map.
+ * @param map The map to destroy.
+ */
+OAPI void _SortedMap_Destroy(SortedMapT map);
+
+/**
+ * Get the number of entries in the map.
+ * @param map A pointer to the map.
+ * @return The number of entries in the map.
+ */
+OAPI U64 _SortedMap_Size(ConstSortedMapT map);
+
+/**
+ * Get the number of entries the map can hold without growing.
+ * @param map A pointer to the map.
+ * @return The capacity of the map.
+ */
+OAPI U64 _SortedMap_Capacity(ConstSortedMapT map);
+
+/**
+ * Ensure the map can hold the given number of entries without growing.
+ * @param map A pointer to the map.
+ * @param count The number of entries to reserve space for.
+ * @return TRUE upon successful reserve, FALSE upon failure.
+ */
+OAPI B8 _SortedMap_Reserve(SortedMapT map, U64 count);
+
+/**
+ * Replace the contents of the map with entries which are already sorted, in linear time.
+ * @param map A pointer to the map.
+ * @param keys The keys of the entries, in strictly ascending order.
+ * @param values The values of the entries, in the same order as their keys, or NULL to zero-initialize them.
+ * @param count The number of entries.
+ * @return TRUE on success, FALSE if the keys are not strictly ascending or upon allocation failure, in which case the
+ * map is unchanged.
+ */
+OAPI B8 _SortedMap_Build(SortedMapT map, const U64* keys, const void* values, U64 count);
+
+/**
+ * Insert an entry into the map, replacing the value of an existing entry with the same key. The value must not point
+ * into the map itself.
+ * @param map A pointer to the map.
+ * @param key The key of the entry.
+ * @param value A pointer to the value, or NULL to zero-initialize the value of a new entry.
+ * @return NULL upon allocation failure, otherwise a pointer to the value within the map.
+ */
+OAPI void* _SortedMap_Insert(SortedMapT map, U64 key, const void* value);
+
+/**
+ * Find the value of the entry with the given key.
+ * @param map A pointer to the map.
+ * @param key The key to search for.
+ * @return NULL if there is no such entry, otherwise a pointer to the value within the map.
+ */
+OAPI void* _SortedMap_Find(ConstSortedMapT map, U64 key);
+
+/**
+ * Remove the entry with the given key from the map.
+ * @param map A pointer to the map.
+ * @param key The key to remove.
+ * @param[out] value A pointer to where the removed value will be placed, or NULL.
+ * @return TRUE if the entry was removed, FALSE if there was no such entry.
+ */
+OAPI B8 _SortedMap_Remove(SortedMapT map, U64 key, void* value);
+
+/**
+ * Remove every entry from the map, keeping its capacity.
+ * @param map A pointer to the map.
+ */
+OAPI void _SortedMap_Clear(SortedMapT map);
+
+/**
+ * Find the first entry whose key is not less than the given key.
+ * @param map A pointer to the map.
+ * @param key The key to search for.
+ * @return The index of the entry, or the size of the map if every key is less than the given key.
+ */
+OAPI U64 _SortedMap_LowerBound(ConstSortedMapT map, U64 key);
+
+/**
+ * Find the first entry whose key is greater than the given key. The entry before it, if any, is the last entry whose
+ * key is not greater than the given key, such as the keyframe in effect at a given time.
+ * @param map A pointer to the map.
+ * @param key The key to search for.
+ * @return The index of the entry, or the size of the map if no key is greater than the given key.
+ */
+OAPI U64 _SortedMap_UpperBound(ConstSortedMapT map, U64 key);
+
+/**
+ * Find the entries whose keys lie within a range. The entries are contiguous, so they can be iterated directly.
+ * @param map A pointer to the map.
+ * @param minKey The smallest key of the range.
+ * @param maxKey The largest key of the range, inclusive.
+ * @param[out] first A pointer to where the index of the first entry in the range will be placed.
+ * @return The number of entries in the range.
+ */
+OAPI U64 _SortedMap_Range(ConstSortedMapT map, U64 minKey, U64 maxKey, U64* first);
+
+/**
+ * Get the key of an entry.
+ * @param map A pointer to the map.
+ * @param index The index of the entry.
+ * @return The key of the entry.
+ */
+OAPI U64 _SortedMap_KeyAt(ConstSortedMapT map, U64 index);
+
+/**
+ * Get the keys of every entry, in ascending order.
+ * @param map A pointer to the map.
+ * @return A pointer to the keys within the map, which is valid until the map next changes size.
+ */
+OAPI const U64* _SortedMap_Keys(ConstSortedMapT map);
+
+// ===== Key helpers =====
+
+/**
+ * Convert a floating-point number into a key which sorts in the same order, for maps keyed by time. Negative zero sorts
+ * before positive zero, and NaNs sort after infinity or before negative infinity depending on their sign.
+ * @param value The number to convert.
+ * @return The key.
+ */
+OAPI U64 SortedMap_KeyFromF64(F64 value);
+
+// ===== User-facing macro implementations =====
+
+/**
+ * Create a sorted map.
+ * @param valueType The type of the map's values.
+ * @return The newly created map.
+ */
+#define SortedMap_Create(valueType) _SortedMap_Create(sizeof(valueType), SortedMap_DefaultCapacity)
+
+/**
+ * Create a sorted map with a specified capacity.
+ * @param valueType The type of the map's values.
+ * @param count The amount of entries the map will be able to hold without growing.
+ * @return The newly created map.
+ */
+#define SortedMap_CreateWithCapacity(valueType, count) _SortedMap_Create(sizeof(valueType), count)
+
+/** Convenience macro for _SortedMap_Destroy(). */
+#define SortedMap_Destroy(map) _SortedMap_Destroy((SortedMapT) map)
+
+/** Convenience macro for _SortedMap_Size(). */
+#define SortedMap_Size(map) _SortedMap_Size((ConstSortedMapT) map)
+
+/** Convenience macro for _SortedMap_Capacity(). */
+#define SortedMap_Capacity(map) _SortedMap_Capacity((ConstSortedMapT) map)
+
+/** Convenience macro for _SortedMap_Reserve(). */
+#define SortedMap_Reserve(map, count) _SortedMap_Reserve((SortedMapT) map, count)
+
+/** Convenience macro for _SortedMap_Build(). */
+#define SortedMap_Build(map, keys, values, count) \
+	_SortedMap_Build((SortedMapT) map, keys, (const void*) values, count)
+
+/** Convenience macro for _SortedMap_Insert(). */
+#define SortedMap_Insert(map, key, value) _SortedMap_Insert((SortedMapT) map, key, (const void*) &value)
+
+/** Convenience macro for _SortedMap_Find(). */
+#define SortedMap_Find(map, key) _SortedMap_Find((ConstSortedMapT) map, key)
+
+/** Convenience macro for _SortedMap_Remove(). */
+#define SortedMap_Remove(map, key, value) _SortedMap_Remove((SortedMapT) map, key, (void*) value)
+
+/** Convenience macro for _SortedMap_Clear(). */
+#define SortedMap_Clear(map) _SortedMap_Clear((SortedMapT) map)
+
+/** Convenience macro for _SortedMap_LowerBound(). */
+#define SortedMap_LowerBound(map, key) _SortedMap_LowerBound((ConstSortedMapT) map, key)
+
+/** Convenience macro for _SortedMap_UpperBound(). */
+#define SortedMap_UpperBound(map, key) _SortedMap_UpperBound((ConstSortedMapT) map, key)
+
+/** Convenience macro for _SortedMap_Range(). */
+#define SortedMap_Range(map, minKey, maxKey, first) _SortedMap_Range((ConstSortedMapT) map, minKey, maxKey, first)
+
+/** Convenience macro for _SortedMap_KeyAt(). */
+#define SortedMap_KeyAt(map, index) _SortedMap_KeyAt((ConstSortedMapT) map, index)
+
+/** Convenience macro for _SortedMap_Keys(). */
+#define SortedMap_Keys(map) _SortedMap_Keys((ConstSortedMapT) map)
@@ -0,0 +1,113 @@
+/** @file
+ *  @brief Sparse set container, holding a set of integers with constant-time membership tests */
+#pragma once
+
+#include <Obsidian/Defines.h>
+
+static const U32 SparseSet_DefaultCapacity = 16;
+
+typedef U32** SparseSetT;
+typedef const U32* const* ConstSparseSetT;
+
+// ===== Internal function implementations =====
+
+/**
+ * Create a sparse set. The set is a pointer to its members, which are stored densely in no particular order, so it can
+ * be iterated like a normal array of U32 up to _SparseSet_Size(). Each member also has a position in the dense array,
+ * which parallel arrays of per-member data can be indexed by. Users should use one of the helper macros such as
+ * SparseSet_Create() instead of this function directly.
+ * @param capacity The amount of members the set will be able to hold without growing.
+ * @param maxValue The largest value the set will be able to hold without growing.
+ * @return NULL upon allocation failure, otherwise a pointer to the created set.
+ * @sa SparseSet_Create(), SparseSet_CreateWithCapacity()
+ */
+OAPI U32* _SparseSet_Create(U64 capacity, U32 maxValue);
+
+/**
+ * Destroys a sparse set.
+ * @param set The set to destroy.
+ */
+OAPI void _SparseSet_Destroy(SparseSetT set);
+
+/**
+ * Get the number of members in the set.
+ * @param set A pointer to the set.
+ * @return The number of members in the set.
+ */
+OAPI U64 _SparseSet_Size(ConstSparseSetT set);
+
+/**
+ * Add a value to the set. Values are indices into the sparse array, so the set uses memory in proportion to the
+ * largest value it has held.
+ * @param set A pointer to the set.
+ * @param value The value to add.
+ * @return TRUE if the value was added or was already a member, FALSE upon allocation failure.
+ */
+OAPI B8 _SparseSet_Add(SparseSetT set, U32 value);
+
+/**
+ * Remove a value from the set. The last member in the dense array is moved into its position.
+ * @param set A pointer to the set.
+ * @param value The value to remove.
+ * @return TRUE if the value was removed, FALSE if it was not a member.
+ */
+OAPI B8 _SparseSet_Remove(SparseSetT set, U32 value);
+
+/**
+ * Determine whether a value is a member of the set.
+ * @param set A pointer to the set.
+ * @param value The value to look for.
+ * @return TRUE if the value is a member, FALSE otherwise.
+ */
+OAPI B8 _SparseSet_Contains(ConstSparseSetT set, U32 value);
+
+/**
+ * Get the position of a member in the dense array.
+ * @param set A pointer to the set.
+ * @param value The value to look for.
+ * @return The position of the value, or the size of the set if it is not a member.
+ */
+OAPI U64 _SparseSet_IndexOf(ConstSparseSetT set, U32 value);
+
+/**
+ * Remove every member of the set, keeping its capacity.
+ * @param set A pointer to the set.
+ */
+OAPI void _SparseSet_Clear(SparseSetT set);
+
+// ===== User-facing macro implementations =====
+
+/**
+ * Create a sparse set.
+ * @return The newly created set.
+ */
+#define SparseSet_Create() _SparseSet_Create(SparseSet_DefaultCapacity, SparseSet_DefaultCapacity - 1)
+
+/**
+ * Create a sparse set with a specified capacity.
+ * @param count The amount of members the set will be able to hold without growing.
+ * @param maxValue The largest value the set will be able to hold without growing.
+ * @return The newly created set.
+ */
+#define SparseSet_CreateWithCapacity(count, maxValue) _SparseSet_Create(count, maxValue)
+
+/** Convenience macro for _SparseSet_Destroy(). */
+#define SparseSet_Destroy(set) _SparseSet_Destroy((SparseSetT) set)
+
+/** Convenience macro for _SparseSet_Size(). */
+#define SparseSet_Size(set) _SparseSet_Size((ConstSparseSetT) set)
+
+/** Convenience macro for _SparseSet_Add(). */
+#define SparseSet_Add(set, value) _SparseSet_Add((SparseSetT) set, value)
+
+/** Convenience macro for _SparseSet_Remove(). */
+#define SparseSet_Remove(set, value) _SparseSet_Remove((SparseSetT) set, value)
+
+/** Convenience macro for _SparseSet_Contains(). */
+#define SparseSet_Contains(set, value) _SparseSet_Contains((ConstSparseSetT) set, value)
+
+/** Convenience macro for _SparseSet_IndexOf(). */
+#define SparseSet_IndexOf(set, value) _SparseSet_IndexOf((ConstSparseSetT) set, value)
+
+/** Convenience macro for _SparseSet_Clear(). */
+#define SparseSet_Clear(set) _SparseSet_Clear((SparseSetT) set)
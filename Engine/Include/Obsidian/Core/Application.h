@@ -3,6 +3,7 @@
 #pragma once
 
 #include <Obsidian/Defines.h>
+#include <Obsidian/Renderer/Common.h>
 
 /** Represents the engine's running application. */
 typedef struct ApplicationT* Application;
@@ -25,8 +26,20 @@ typedef struct ApplicationCreateInfoT {
 	const char* Name;               /**< Name of the application. */
 	ApplicationCallbacks Callbacks; /**< Application lifecycle callbacks. */
 	void* UserData;                 /**< Pointer to any user-specified data. See Application_GetUserData(). */
+	B8 Headless;                    /**< Run without a window. WindowW and WindowH set the virtual framebuffer size. */
+	RenderEngineType RenderEngine;  /**< The render engine to use. Vulkan runs headless on a headless platform. */
+	U64 FrameLimit;                 /**< Exit after running this many frames. 0 runs until shutdown is requested. */
+	B8 Uncapped;                    /**< Run frames back-to-back instead of sleeping to the target frame rate. */
 } ApplicationCreateInfo;
 
+/** Frame timing statistics, gathered while the application is running. */
+typedef struct ApplicationFrameStatsT {
+	U64 FrameCount;     /**< Number of frames that have been run. */
+	F64 TotalFrameTime; /**< Total time in seconds spent running frames, not including time spent sleeping. */
+	F64 MinFrameTime;   /**< Shortest frame time in seconds. */
+	F64 MaxFrameTime;   /**< Longest frame time in seconds. */
+} ApplicationFrameStats;
+
 /**
  * Create the application.
  * @param createInfo A pointer to a struct of information used to create the application.
@@ -43,7 +56,7 @@ OAPI B8 Application_Create(const ApplicationCreateInfo* createInfo, Application*
 OAPI B8 Application_Run(Application app);
 
 /**
- * Shutdown the application.
+ * Shutdown the application. Calling this again after the application has shut down does nothing.
  * @param app The application to shut down.
  */
 OAPI void Application_Shutdown(Application app);
@@ -54,6 +67,13 @@ OAPI void Application_Shutdown(Application app);
  */
 OAPI void Application_RequestShutdown(Application app);
 
+/**
+ * Retrieve the frame timing statistics gathered by Application_Run().
+ * @param app The application to fetch statistics for.
+ * @param[out] stats A pointer to where the statistics will be stored.
+ */
+OAPI void Application_GetFrameStats(Application app, ApplicationFrameStats* stats);
+
 /**
  * Set the UserData pointer.
  * @param app The application to save to.
@@ -12,7 +12,7 @@ extern B8 GetApplicationInfo(ApplicationCreateInfo* createInfo);
 
 int main(int argc, const char** argv) {
 	int status = 0;
-	ApplicationCreateInfo info;
+	ApplicationCreateInfo info = {};
 	Application app = NULL;
 
 	if (!Memory_Initialize()) {
@@ -11,10 +11,13 @@ typedef enum MemoryTag {
 
 	// Data Structures
 	MemoryTag_Array,            /**< Used by static-sized arrays. */
-	MemoryTag_BinarySearchTree, /**< Used by binary search trees. */
+	MemoryTag_BinarySearchTree, /**< Used by binary search trees and sorted maps. */
+	MemoryTag_Bitset,           /**< Used by bitsets. */
 	MemoryTag_Dictionary,       /**< Used by dictionaries/hash maps. */
 	MemoryTag_DynamicArray,     /**< Used by dynamically-sized arrays. */
 	MemoryTag_RingQueue,        /**< Used by ring queues. */
+	MemoryTag_SlotMap,          /**< Used by slot maps. */
+	MemoryTag_SparseSet,        /**< Used by sparse sets. */
 	MemoryTag_String,           /**< Used by strings. */
 
 	// Working Memory
@@ -36,17 +39,105 @@ typedef enum MemoryTag {
 	MemoryTag_End /**< Count of total memory tags. */
 } MemoryTag;
 
+/** Flags controlling how a block of memory is allocated. */
+typedef enum MemoryFlagBits {
+	MemoryFlag_None      = 0,      /**< Allocate from the general-purpose heap. */
+	MemoryFlag_HugePages = 1 << 0, /**< Back the allocation with huge pages where possible. */
+} MemoryFlagBits;
+typedef U32 MemoryFlags;
+
+/** Statistics reported by a custom allocator. */
+typedef struct MemoryAllocatorStats {
+	size_t UsedBytes;     /**< Bytes currently handed out by the allocator. */
+	size_t ReservedBytes; /**< Bytes the allocator holds from the system, including unused space. */
+} MemoryAllocatorStats;
+
+/**
+ * A custom allocator which the blocks of one or more memory tags can be routed to with Memory_SetTagAllocator().
+ * Blocks still carry the memory system's metadata, so tags, statistics and tracking work the same as for the built-in
+ * heap. All functions may be called from any thread.
+ */
+typedef struct MemoryAllocator {
+	const char* Name; /**< Name of the allocator, for logging. */
+	void* UserData;   /**< Passed to every function of the allocator. */
+	/** Allocate a block of at least size bytes with the given alignment. Returns NULL upon failure. */
+	void* (*Allocate)(void* userData, size_t size, size_t align);
+	/** Resize a block, keeping its contents and alignment. Returns NULL upon failure. May be NULL, in which case
+	 * blocks are resized by allocating a new block and freeing the old one. */
+	void* (*Reallocate)(void* userData, void* ptr, size_t oldSize, size_t newSize, size_t align);
+	/** Free a block of the given size and alignment. */
+	void (*Free)(void* userData, void* ptr, size_t size, size_t align);
+	/** Fill in the allocator's statistics for Memory_LogUsage(). May be NULL. */
+	void (*GetStats)(void* userData, MemoryAllocatorStats* stats);
+} MemoryAllocator;
+
+/** A position in the calling thread's scratch allocator, to rewind to at the end of a scope. */
+typedef struct MemoryScratch {
+	size_t Marker; /**< Bytes of the scratch allocator in use when the scope began. */
+} MemoryScratch;
+
+/** A snapshot of the memory allocated through Memory_Allocate() and friends, summed across all threads. */
+typedef struct MemoryUsage {
+	size_t TotalAllocations;                   /**< Number of live allocations. */
+	size_t TotalAllocatedBytes;                /**< Bytes allocated, including tracking overhead. */
+	size_t AllocationsByTag[MemoryTag_End];    /**< Number of live allocations for each tag. */
+	size_t AllocatedBytesByTag[MemoryTag_End]; /**< Bytes allocated for each tag. */
+	size_t CachedBytes;                        /**< Bytes of freed small blocks held for reuse. */
+} MemoryUsage;
+
+/** Number of frames kept in the memory frame history. */
+#define MEMORY_FRAME_HISTORY_LENGTH 256
+
+/** Heap activity during a single frame, summed across all threads. */
+typedef struct MemoryFrameRecord {
+	U64 Frame;                                 /**< Index of the frame, counting from Memory_Initialize(). */
+	size_t Allocations;                        /**< Number of heap allocations made. */
+	size_t Frees;                              /**< Number of heap allocations freed. */
+	size_t AllocatedBytes;                     /**< Bytes requested by heap allocations. */
+	size_t FreedBytes;                         /**< Bytes released by heap frees. */
+	size_t AllocationsByTag[MemoryTag_End];    /**< Number of heap allocations made for each tag. */
+	size_t FreesByTag[MemoryTag_End];          /**< Number of heap allocations freed for each tag. */
+	size_t AllocatedBytesByTag[MemoryTag_End]; /**< Bytes requested by heap allocations for each tag. */
+	size_t FreedBytesByTag[MemoryTag_End];     /**< Bytes released by heap frees for each tag. */
+	size_t LiveBytes;                          /**< Bytes allocated from the heap at the end of the frame. */
+	size_t FrameArenaBytes;                    /**< Bytes allocated from the frame arena during the frame. */
+} MemoryFrameRecord;
+
+/** File formats supported by Memory_DumpFrameHistory(). */
+typedef enum MemoryDumpFormat {
+	MemoryDumpFormat_CSV, /**< One row per frame and tag with any activity, plus a "Total" row for every frame. */
+	MemoryDumpFormat_JSON /**< An array of frames, each with its totals and an object of per-tag counters. */
+} MemoryDumpFormat;
+
 /**
- * Initialize the memory subsystem.
+ * Initialize the memory subsystem. This must be called from the main thread, before any other thread allocates.
  * @return TRUE on success, FALSE otherwise.
  */
 OAPI B8 Memory_Initialize();
 
 /**
- * Shutdown the memory subsystem.
+ * Shutdown the memory subsystem. No other thread may allocate after this is called.
  */
 OAPI void Memory_Shutdown();
 
+/**
+ * Release the calling thread's small-block cache, scratch allocator and statistics, so that their memory can be used by
+ * other threads. Threads created with Platform_ThreadCreate() do this when they exit, any other thread which allocates
+ * should call this before it exits. The thread may still allocate afterwards.
+ */
+OAPI void Memory_ThreadShutdown();
+
+/**
+ * Route every future allocation of a memory tag to a custom allocator, without changing any call sites. Blocks
+ * remember which allocator they came from, so blocks allocated before the change are still freed correctly, as long
+ * as their allocator's user data stays valid. This must not be called concurrently with itself.
+ * @param tag The tag to route.
+ * @param allocator The allocator to use, which is copied, or NULL to return the tag to the built-in heap. When
+ * OBSIDIAN_MEMORY_GUARD is enabled, the built-in heap is the guard page allocator.
+ * @return TRUE on success, FALSE if too many different allocators have been registered.
+ */
+OAPI B8 Memory_SetTagAllocator(MemoryTag tag, const MemoryAllocator* allocator);
+
 /**
  * Allocate a block of memory from the platform.
  * @param size The number of bytes to allocate.
@@ -58,11 +149,21 @@ OAPI void* Memory_Allocate(size_t size, MemoryTag tag);
 /**
  * Allocate a block of memory from the platform with a specific allocation.
  * @param size The number of bytes to allocate.
+ * @param align The alignment to use when allocating. Must be a power of two, or 0 for the default alignment.
+ * @param tag The tag which this memory relates to.
+ * @return NULL upon allocation failure, otherwise a pointer to the requested block of memory.
+ */
+OAPI void* Memory_AllocateAligned(size_t size, size_t align, MemoryTag tag);
+
+/**
+ * Allocate a block of memory backed by huge pages where possible, to reduce TLB misses when accessing large, long-lived
+ * data. Allocations smaller than a huge page are served from regular pages. The block is freed with Memory_Free().
+ * @param size The number of bytes to allocate.
  * @param align The alignment to use when allocating.
  * @param tag The tag which this memory relates to.
  * @return NULL upon allocation failure, otherwise a pointer to the requested block of memory.
  */
-OAPI void* Memory_AllocateAligned(size_t size, U8 align, MemoryTag tag);
+OAPI void* Memory_AllocateHuge(size_t size, size_t align, MemoryTag tag);
 
 /**
  * Reallocate a block of memory to the new specified size.
@@ -72,12 +173,122 @@ OAPI void* Memory_AllocateAligned(size_t size, U8 align, MemoryTag tag);
  */
 OAPI void* Memory_Reallocate(void* ptr, size_t size);
 
+/**
+ * Get the number of bytes the heap would really set aside for an allocation of the given size. Allocations are rounded
+ * up to size classes or pages internally, so containers which can make use of the extra space should ask for this many
+ * bytes instead of wasting it.
+ * @param size The number of bytes to allocate.
+ * @param tag The tag the memory would be allocated with.
+ * @return The number of usable bytes, which is at least the given size.
+ */
+OAPI size_t Memory_GetGoodSize(size_t size, MemoryTag tag);
+
+/**
+ * Allocate a block of memory, recording where it was allocated from. Users should use Memory_Allocate(),
+ * Memory_AllocateAligned() or Memory_AllocateHuge() instead of this function directly.
+ * @param size The number of bytes to allocate.
+ * @param align The alignment to use when allocating.
+ * @param tag The tag which this memory relates to.
+ * @param flags Flags controlling how the memory is allocated.
+ * @param file The source file the allocation was made from, or NULL if unknown.
+ * @param line The source line the allocation was made from.
+ * @return NULL upon allocation failure, otherwise a pointer to the requested block of memory.
+ */
+OAPI void* _Memory_AllocateAt(
+	size_t size, size_t align, MemoryTag tag, MemoryFlags flags, const char* file, U32 line);
+
+/**
+ * Reallocate a block of memory, recording where it was reallocated from. Users should use Memory_Reallocate() instead
+ * of this function directly.
+ * @param ptr The existing allocation.
+ * @param size The new size in bytes.
+ * @param file The source file the reallocation was made from, or NULL if unknown.
+ * @param line The source line the reallocation was made from.
+ * @return NULL upon reallocation failure, otherwise a pointer to the resized block of memory.
+ */
+OAPI void* _Memory_ReallocateAt(void* ptr, size_t size, const char* file, U32 line);
+
+#if OBSIDIAN_MEMORY_TRACKING == 1
+// When allocation tracking is enabled, record the call site of every allocation.
+#	define Memory_Allocate(size, tag) _Memory_AllocateAt(size, 0, tag, MemoryFlag_None, __FILE__, __LINE__)
+#	define Memory_AllocateAligned(size, align, tag) \
+		_Memory_AllocateAt(size, align, tag, MemoryFlag_None, __FILE__, __LINE__)
+#	define Memory_AllocateHuge(size, align, tag) \
+		_Memory_AllocateAt(size, align, tag, MemoryFlag_HugePages, __FILE__, __LINE__)
+#	define Memory_Reallocate(ptr, size) _Memory_ReallocateAt(ptr, size, __FILE__, __LINE__)
+#endif
+
 /**
  * Free a previously requested block of memory.
  * @param ptr A pointer previously returned by Memory_Allocate() or Memory_AllocateAligned().
  */
 OAPI void Memory_Free(void* ptr);
 
+/**
+ * Allocate a block of transient memory from the frame arena. Frame allocations are never freed individually, and
+ * remain valid until the end of the frame after the one they were allocated in. The frame arena may only be used from
+ * the main thread.
+ * @param size The number of bytes to allocate.
+ * @param tag The tag which this memory relates to.
+ * @return NULL upon allocation failure, otherwise a pointer to the requested block of memory.
+ */
+OAPI void* Memory_FrameAlloc(size_t size, MemoryTag tag);
+
+/**
+ * Allocate a block of transient memory from the frame arena with a specific alignment.
+ * @param size The number of bytes to allocate.
+ * @param align The alignment to use when allocating. Must be a power of two, or 0 for the default alignment.
+ * @param tag The tag which this memory relates to.
+ * @return NULL upon allocation failure, otherwise a pointer to the requested block of memory.
+ */
+OAPI void* Memory_FrameAllocAligned(size_t size, size_t align, MemoryTag tag);
+
+/**
+ * Advance the frame arena to the next frame, releasing everything allocated before the previous call.
+ * This is called by Application_Run() at the end of every frame.
+ */
+OAPI void Memory_FrameReset();
+
+/**
+ * Begin a scope of scratch allocations on the calling thread. Every scratch allocation made until the matching
+ * Memory_ScratchEnd() is released all at once when it is called. Scopes may be nested, but must end in the reverse
+ * order they began.
+ * @return The marker to pass to Memory_ScratchEnd().
+ */
+OAPI MemoryScratch Memory_ScratchBegin();
+
+/**
+ * End a scope of scratch allocations, releasing every scratch allocation made since the matching Memory_ScratchBegin().
+ * @param scratch The marker returned by Memory_ScratchBegin().
+ */
+OAPI void Memory_ScratchEnd(MemoryScratch scratch);
+
+/**
+ * Allocate a block of temporary memory from the calling thread's scratch allocator. This may only be called inside a
+ * scratch scope, and the memory must not be used after the scope ends or by another thread.
+ * @param size The number of bytes to allocate.
+ * @return NULL upon allocation failure, otherwise a pointer to the requested block of memory.
+ */
+OAPI void* Memory_ScratchAlloc(size_t size);
+
+/**
+ * Allocate a block of temporary memory from the calling thread's scratch allocator with a specific alignment.
+ * @param size The number of bytes to allocate.
+ * @param align The alignment to use when allocating. Must be a power of two, or 0 for the default alignment.
+ * @return NULL upon allocation failure, otherwise a pointer to the requested block of memory.
+ */
+OAPI void* Memory_ScratchAllocAligned(size_t size, size_t align);
+
+/**
+ * Resize a block of scratch memory. The most recent scratch allocation is resized in place, any other block is copied
+ * to a new allocation with the default alignment, leaving the old one in place until the scope ends.
+ * @param ptr The existing scratch allocation, or NULL to make a new one.
+ * @param oldSize The current size of the allocation in bytes.
+ * @param newSize The new size in bytes.
+ * @return NULL upon allocation failure, otherwise a pointer to the resized block of memory.
+ */
+OAPI void* Memory_ScratchRealloc(void* ptr, size_t oldSize, size_t newSize);
+
 /**
  * Copy bytes from one area of memory to another.
  * @param dst A pointer to the destination memory.
@@ -109,7 +320,61 @@ OAPI void Memory_Set(void* dst, U8 value, size_t bytes);
  */
 OAPI void Memory_Zero(void* dst, size_t bytes);
 
+/**
+ * Get the human-readable name of a memory tag.
+ * @param tag The tag to fetch the name of.
+ * @return The name of the tag.
+ */
+OAPI const char* Memory_GetTagName(MemoryTag tag);
+
+/**
+ * Gather the current memory usage from every thread.
+ * @param[out] usage A pointer to where the memory usage will be stored.
+ */
+OAPI void Memory_GetUsage(MemoryUsage* usage);
+
 /**
  * Log the current memory usage to console.
  */
 OAPI void Memory_LogUsage();
+
+/**
+ * Get the heap activity of the most recent frames, oldest first. A frame ends each time Memory_FrameReset() is called.
+ * @param[out] records A pointer to where the records will be stored.
+ * @param maxRecords The maximum number of records to store. At most MEMORY_FRAME_HISTORY_LENGTH are available.
+ * @return The number of records stored.
+ */
+OAPI U32 Memory_GetFrameHistory(MemoryFrameRecord* records, U32 maxRecords);
+
+/**
+ * Write the heap activity of the most recent frames to a file, oldest first.
+ * @param path The path of the file to write, which is overwritten if it exists.
+ * @param format The format to write the file in.
+ * @return TRUE on success, FALSE if the file could not be written.
+ */
+OAPI B8 Memory_DumpFrameHistory(const char* path, MemoryDumpFormat format);
+
+/**
+ * Log the allocation sites holding the most live memory, and the sites which have made the most allocations overall.
+ * This requires the engine to be built with OBSIDIAN_MEMORY_TRACKING enabled.
+ * @param count The number of sites to list in each category.
+ */
+OAPI void Memory_LogAllocationSites(U32 count);
+
+// ===== Internal functions =====
+
+/**
+ * Record a region of memory which has asked to be backed by huge pages, so that Memory_LogUsage() can report how much
+ * of it actually is.
+ * @param ptr A pointer to the start of the region.
+ * @param bytes The size of the region in bytes.
+ * @param tag The tag which the region relates to.
+ * @param explicitHuge TRUE if the region is guaranteed to be backed by huge pages.
+ */
+void Memory_RegisterHugeRegion(void* ptr, size_t bytes, MemoryTag tag, B8 explicitHuge);
+
+/**
+ * Forget about a region previously recorded with Memory_RegisterHugeRegion().
+ * @param ptr A pointer to the start of the region.
+ */
+void Memory_UnregisterHugeRegion(void* ptr);
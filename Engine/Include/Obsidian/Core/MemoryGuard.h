@@ -0,0 +1,24 @@
+/** @file
+ *  @brief Guard page allocator, used by the memory subsystem when OBSIDIAN_MEMORY_GUARD is enabled. */
+#pragma once
+
+#include <Obsidian/Core/Memory.h>
+#include <Obsidian/Defines.h>
+
+#if OBSIDIAN_MEMORY_GUARD == 1
+/**
+ * Initialize the guard page allocator.
+ */
+void MemoryGuard_Initialize();
+
+/**
+ * Release every block waiting in quarantine. Blocks which are still live are left alone.
+ */
+void MemoryGuard_Shutdown();
+
+/**
+ * Get the guard page allocator, to be used for every memory tag which has no other allocator.
+ * @return The guard page allocator.
+ */
+const MemoryAllocator* MemoryGuard_GetAllocator();
+#endif
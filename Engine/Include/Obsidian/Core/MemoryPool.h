@@ -0,0 +1,60 @@
+/** @file
+ *  @brief Fixed-size block pool allocator */
+#pragma once
+
+#include <Obsidian/Core/Memory.h>
+#include <Obsidian/Defines.h>
+
+/**
+ * A pool of fixed-size elements. Elements are carved out of large chunks of memory, and freed elements are kept on an
+ * intrusive free list, so allocating and freeing is O(1) with no per-element tracking overhead.
+ */
+typedef struct MemoryPool {
+	size_t ElementSize;    /**< Size of each element in bytes, including alignment padding. */
+	size_t Alignment;      /**< Alignment of each element. */
+	U32 ElementsPerChunk;  /**< Number of elements allocated each time the pool grows. */
+	MemoryTag Tag;         /**< The tag which this pool's memory relates to. */
+	void* Chunks;          /**< Linked list of chunks owned by this pool. */
+	void* FreeList;        /**< Linked list of freed elements available for reuse. */
+	void* Cursor;          /**< Next never-used element in the newest chunk. */
+	void* CursorEnd;       /**< End of the newest chunk. */
+	U64 ElementsInUse;     /**< Number of elements currently allocated. */
+	U64 ElementCapacity;   /**< Number of elements the pool can hold without growing. */
+	U64 ElementsHighWater; /**< Largest number of elements that have been allocated at once. */
+} MemoryPool;
+
+/**
+ * Create a pool allocator. No memory is allocated until the first element is requested.
+ * @param pool The pool to initialize.
+ * @param elementSize The size of each element, in bytes.
+ * @param align The alignment of each element, or 0 to use the default alignment.
+ * @param elementsPerChunk The number of elements to allocate each time the pool grows.
+ * @param tag The tag which this pool's memory relates to.
+ * @return TRUE on success, FALSE otherwise.
+ */
+OAPI B8 MemoryPool_Create(MemoryPool* pool, size_t elementSize, size_t align, U32 elementsPerChunk, MemoryTag tag);
+
+/**
+ * Destroy a pool allocator, releasing all of its memory. Any elements still allocated become invalid.
+ * @param pool The pool to destroy.
+ */
+OAPI void MemoryPool_Destroy(MemoryPool* pool);
+
+/**
+ * Allocate an element from the pool.
+ * @param pool The pool to allocate from.
+ * @return NULL upon allocation failure, otherwise a pointer to an uninitialized element.
+ */
+OAPI void* MemoryPool_Alloc(MemoryPool* pool);
+
+/**
+ * Return an element to the pool.
+ * @param pool The pool the element was allocated from.
+ * @param ptr A pointer previously returned by MemoryPool_Alloc() for this pool.
+ */
+OAPI void MemoryPool_Free(MemoryPool* pool, void* ptr);
+
+/**
+ * Log the occupancy of all pools to console, grouped by memory tag.
+ */
+OAPI void MemoryPool_LogUsage();
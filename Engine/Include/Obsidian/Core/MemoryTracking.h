@@ -0,0 +1,40 @@
+/** @file
+ *  @brief Allocation-site tracking, used by the memory subsystem when OBSIDIAN_MEMORY_TRACKING is enabled. */
+#pragma once
+
+#include <Obsidian/Core/Memory.h>
+#include <Obsidian/Defines.h>
+
+#if OBSIDIAN_MEMORY_TRACKING == 1
+/**
+ * Initialize allocation tracking.
+ */
+void MemoryTracking_Initialize();
+
+/**
+ * Report every allocation which is still live, then release all tracking data.
+ */
+void MemoryTracking_Shutdown();
+
+/**
+ * Record a new allocation, along with the call stack that made it.
+ * @param ptr The user-visible pointer of the allocation.
+ * @param size The size of the allocation in bytes.
+ * @param tag The tag which the allocation relates to.
+ * @param file The source file the allocation was made from, or NULL if unknown.
+ * @param line The source line the allocation was made from.
+ */
+void MemoryTracking_Add(void* ptr, size_t size, MemoryTag tag, const char* file, U32 line);
+
+/**
+ * Forget about an allocation which is being freed.
+ * @param ptr The user-visible pointer of the allocation.
+ */
+void MemoryTracking_Remove(void* ptr);
+
+/**
+ * Log the top allocation sites by live bytes and by total allocations.
+ * @param count The number of sites to list in each category.
+ */
+void MemoryTracking_LogSites(U32 count);
+#endif
@@ -27,3 +27,27 @@ OAPI char* String_Duplicate(const char* str);
  * @return TRUE if the strings are equal, FALSE otherwise.
  */
 OAPI B8 String_Equal(const char* a, const char* b);
+
+/**
+ * Hash a string with 32-bit FNV-1a, for compact keys where the occasional collision is acceptable or checked for.
+ * @param str The string to hash.
+ * @return The string's hash.
+ */
+OAPI U32 String_Hash32(const char* str);
+
+/**
+ * Hash a string with 64-bit FNV-1a. This is the hash StringId values are made of, so it can be compared against a
+ * StringId without interning the string.
+ * @param str The string to hash.
+ * @return The string's hash.
+ * @sa StringId_Intern()
+ */
+OAPI U64 String_Hash64(const char* str);
+
+/**
+ * Hash the first bytes of a string with 64-bit FNV-1a, for strings which are not null-terminated.
+ * @param str The string to hash.
+ * @param length The number of bytes to hash.
+ * @return The string's hash.
+ */
+OAPI U64 String_HashLength64(const char* str, U64 length);
@@ -0,0 +1,82 @@
+/** @file
+ *  @brief String interning, identifying strings by a 64-bit hash so they can be compared as integers */
+#pragma once
+
+#include <Obsidian/Defines.h>
+
+/**
+ * Identifies a string by its 64-bit FNV-1a hash. The same string always has the same ID, in every run and on every
+ * platform, so IDs of literals can be folded into constants with StringId_Literal() or stored in asset files.
+ */
+typedef U64 StringId;
+
+/** Longest string literal which StringId_Literal() can hash, one byte for each step of _StringId_Step64(). */
+#define STRING_ID_LITERAL_MAX 64
+
+/**
+ * Initialize the string interning system. The application does this itself; other programs using the engine, such as
+ * tests, must do so before interning any strings.
+ * @return TRUE on success, FALSE on failure.
+ */
+OAPI B8 StringId_Initialize();
+
+/**
+ * Shut down the string interning system, freeing every interned string.
+ */
+OAPI void StringId_Shutdown();
+
+/**
+ * Intern a string, keeping a copy of it so that its ID can be turned back into the string. Interned strings are never
+ * freed, and live until the engine shuts down. Interning may only be done from the main thread.
+ * @param str The string to intern.
+ * @return The string's ID.
+ * @sa StringId_GetString()
+ */
+OAPI StringId StringId_Intern(const char* str);
+
+/**
+ * Intern the first bytes of a string which is not null-terminated.
+ * @param str The string to intern.
+ * @param length The number of bytes of the string.
+ * @return The string's ID.
+ * @sa StringId_Intern()
+ */
+OAPI StringId StringId_InternLength(const char* str, U64 length);
+
+/**
+ * Get the ID of a string without interning it. This only hashes the string, so it may be used from any thread.
+ * @param str The string.
+ * @return The string's ID.
+ */
+OAPI StringId StringId_FromString(const char* str);
+
+/**
+ * Get the string an ID was interned from.
+ * @param id The ID of the string.
+ * @return The interned string, or NULL if no string with this ID has been interned.
+ */
+OAPI const char* StringId_GetString(StringId id);
+
+// One step of FNV-1a over a string literal. Bytes past the end of the literal leave the hash unchanged, by hashing in
+// nothing and multiplying by 1, which keeps each step to a single use of the hash so the expansion stays linear.
+#define _StringId_Step(str, i, hash)                                                           \
+	(((hash) ^ ((i) < sizeof(str) - 1 ? (U8) (str)[(i) < sizeof(str) - 1 ? (i) : 0] : 0)) * \
+	 ((i) < sizeof(str) - 1 ? 0x100000001B3ull : 1))
+#define _StringId_Step4(str, i, hash) \
+	_StringId_Step(str, i + 3, _StringId_Step(str, i + 2, _StringId_Step(str, i + 1, _StringId_Step(str, i, hash))))
+#define _StringId_Step16(str, i, hash) \
+	_StringId_Step4(str, i + 12, _StringId_Step4(str, i + 8, _StringId_Step4(str, i + 4, _StringId_Step4(str, i, hash))))
+
+#define _StringId_Step64(str, hash) \
+	_StringId_Step16(str, 48, _StringId_Step16(str, 32, _StringId_Step16(str, 16, _StringId_Step16(str, 0, hash))))
+
+/**
+ * Get the ID of a string literal. The hash is written out as an expression over the literal's characters, which the
+ * optimizer folds down to a single constant, so it costs nothing at runtime. Indexing a literal is not an integer
+ * constant expression though, so the result cannot be used as a case label or array size.
+ * @param str A string literal of at most STRING_ID_LITERAL_MAX characters. Longer literals fail to compile.
+ * @return The literal's ID.
+ */
+#define StringId_Literal(str)                                                             \
+	((StringId) (sizeof(char[sizeof("" str) <= STRING_ID_LITERAL_MAX + 1 ? 1 : -1]) * 0 + \
+	             _StringId_Step64(str, 0xCBF29CE484222325ull)))
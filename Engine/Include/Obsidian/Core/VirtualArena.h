@@ -0,0 +1,81 @@
+/** @file
+ *  @brief Reserve-commit virtual memory arena */
+#pragma once
+
+#include <Obsidian/Core/Memory.h>
+#include <Obsidian/Defines.h>
+
+/**
+ * An arena which reserves a large range of address space up front, and only commits memory to it as it is used.
+ * Because the range never moves, the arena can grow in place without copying, and pointers into it stay valid.
+ */
+typedef struct VirtualArena {
+	void* Base;       /**< Start of the reserved address range. */
+	size_t Reserved;  /**< Number of bytes of address space reserved. */
+	size_t Committed; /**< Number of bytes at the start of the range which are backed by memory. */
+	size_t Used;      /**< Number of bytes at the start of the range which are in use. */
+	MemoryTag Tag;    /**< The tag which this arena's memory relates to. */
+	B8 HugePages;     /**< Whether the arena asked for its memory to be backed by huge pages. */
+} VirtualArena;
+
+/**
+ * Create a virtual arena, reserving address space without committing any memory.
+ * @param arena The arena to initialize.
+ * @param reserveBytes The maximum number of bytes the arena can grow to. Rounded up to the page size.
+ * @param tag The tag which this arena's memory relates to.
+ * @return TRUE on success, FALSE otherwise.
+ */
+OAPI B8 VirtualArena_Create(VirtualArena* arena, size_t reserveBytes, MemoryTag tag);
+
+/**
+ * Create a virtual arena whose memory is backed by huge pages where the operating system allows it. Memory is
+ * committed a whole huge page at a time.
+ * @param arena The arena to initialize.
+ * @param reserveBytes The maximum number of bytes the arena can grow to. Rounded up to the huge page size.
+ * @param tag The tag which this arena's memory relates to.
+ * @return TRUE on success, FALSE otherwise.
+ */
+OAPI B8 VirtualArena_CreateHuge(VirtualArena* arena, size_t reserveBytes, MemoryTag tag);
+
+/**
+ * Destroy a virtual arena, releasing its address space and all committed memory. The arena structure itself is not
+ * written to, so it may live within the arena's own memory.
+ * @param arena The arena to destroy.
+ */
+OAPI void VirtualArena_Destroy(VirtualArena* arena);
+
+/**
+ * Allocate a block of memory from the end of the arena, committing more memory if required.
+ * @param arena The arena to allocate from.
+ * @param size The number of bytes to allocate.
+ * @param align The alignment of the allocation. Must be a power of two, or 0 for the default alignment.
+ * @return NULL if the arena's reservation is exhausted or memory could not be committed, otherwise a pointer to the
+ * block of memory. Memory which has never been used before is zeroed.
+ */
+OAPI void* VirtualArena_Alloc(VirtualArena* arena, size_t size, size_t align);
+
+/**
+ * Grow or shrink the used portion of the arena, committing more memory if required. Shrinking does not return memory
+ * to the operating system, see VirtualArena_Trim().
+ * @param arena The arena to resize.
+ * @param used The number of bytes which should be in use.
+ * @return TRUE on success, FALSE if the arena's reservation is exhausted or memory could not be committed.
+ */
+OAPI B8 VirtualArena_SetUsed(VirtualArena* arena, size_t used);
+
+/**
+ * Mark the whole arena as unused, keeping its memory committed.
+ * @param arena The arena to reset.
+ */
+OAPI void VirtualArena_Reset(VirtualArena* arena);
+
+/**
+ * Return any committed pages beyond the used portion of the arena to the operating system.
+ * @param arena The arena to trim.
+ */
+OAPI void VirtualArena_Trim(VirtualArena* arena);
+
+/**
+ * Log the reserved and committed memory of all virtual arenas to console, grouped by memory tag.
+ */
+OAPI void VirtualArena_LogUsage();
@@ -2,6 +2,8 @@
  *  @brief Contains global typedefs and macro definitions for the engine */
 #pragma once
 
+#include <stddef.h>
+
 // Integer typedefs
 typedef unsigned char U8;
 typedef unsigned short U16;
@@ -17,7 +19,7 @@ typedef int B32;
 typedef char B8;
 
 // Ensure we have a static assert depending on compiler
-#if defined(__clang__) || defined(__gcc__)
+#if defined(__clang__) || defined(__GNUC__)
 #	define STATIC_ASSERT _Static_assert
 #else
 #	define STATIC_ASSERT static_assert
@@ -42,7 +44,6 @@ enum { FALSE = 0, TRUE = 1 };
 #if defined(_WIN64)
 #	define OBSIDIAN_WINDOWS 1
 #elif defined(__linux__) || defined(__gnu_linux__)
-#	error "Linux support is not yet available!"
 #	define OBSIDIAN_LINUX 1
 #	if defined(__ANDROID__)
 #		define OBSIDIAN_ANDROID 1
@@ -96,3 +97,13 @@ enum { FALSE = 0, TRUE = 1 };
 #		define OAPI
 #	endif
 #endif
+
+// Thread-local storage
+#if defined(_MSC_VER) && !defined(__clang__)
+#	define THREAD_LOCAL __declspec(thread)
+#else
+#	define THREAD_LOCAL _Thread_local
+#endif
+
+// Size of a CPU cache line, used to keep data written by different threads apart
+#define CACHE_LINE_SIZE 64
@@ -2,11 +2,23 @@
  *  @brief Main header, contains all essential header files. */
 #pragma once
 
+#include <Obsidian/Containers/Bitset.h>
+#include <Obsidian/Containers/Dictionary.h>
 #include <Obsidian/Containers/DynArray.h>
+#include <Obsidian/Containers/FreeList.h>
+#include <Obsidian/Containers/List.h>
+#include <Obsidian/Containers/RingQueue.h>
+#include <Obsidian/Containers/SlotMap.h>
+#include <Obsidian/Containers/Sort.h>
+#include <Obsidian/Containers/SortedMap.h>
+#include <Obsidian/Containers/SparseSet.h>
 #include <Obsidian/Core/Application.h>
 #include <Obsidian/Core/EntryPoint.h>
 #include <Obsidian/Core/Event.h>
 #include <Obsidian/Core/Input.h>
 #include <Obsidian/Core/Logger.h>
 #include <Obsidian/Core/Memory.h>
+#include <Obsidian/Core/MemoryPool.h>
+#include <Obsidian/Core/StringId.h>
+#include <Obsidian/Core/VirtualArena.h>
 #include <Obsidian/Platform/Platform.h>
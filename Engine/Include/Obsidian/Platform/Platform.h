@@ -8,6 +8,22 @@
 /** Platform state object, used when interacting with the host hardware and operating system. */
 typedef struct PlatformStateT* PlatformState;
 
+/** A thread created by Platform_ThreadCreate(). */
+typedef struct PlatformThreadT* PlatformThread;
+
+/**
+ * The function run by a thread.
+ * @param userData The pointer given to Platform_ThreadCreate().
+ */
+typedef void (*PlatformThreadFn)(void* userData);
+
+/** Access allowed to a range of committed virtual memory. */
+typedef enum PlatformPageAccess {
+	PlatformPageAccess_None,      /**< Any access faults. */
+	PlatformPageAccess_Read,      /**< The pages may be read, but writing faults. */
+	PlatformPageAccess_ReadWrite, /**< The pages may be read and written. This is the access of newly committed pages. */
+} PlatformPageAccess;
+
 /**
  *  Initialize the platform layer.
  *  @param[out] state A pointer to a PlatformState object. The function will allocate and initialize the object.
@@ -23,6 +39,24 @@ typedef struct PlatformStateT* PlatformState;
  */
 B8 Platform_Initialize(PlatformState* state, const char* appName, I32 windowX, I32 windowY, I32 windowW, I32 windowH);
 
+/**
+ *  Initialize the platform layer without creating a window or connecting to a display.
+ *  @param[out] state A pointer to a PlatformState object. The function will allocate and initialize the object.
+ *  @param appName The application's name.
+ *  @param width The width of the virtual framebuffer.
+ *  @param height The height of the virtual framebuffer.
+ *  @return TRUE on success, FALSE on error.
+ *  @sa Platform_Shutdown(), Platform_IsHeadless()
+ */
+B8 Platform_InitializeHeadless(PlatformState* state, const char* appName, U32 width, U32 height);
+
+/**
+ * Determine whether the platform layer was initialized without a window.
+ * @param state A PlatformState object previously returned by Platform_Initialize() or Platform_InitializeHeadless().
+ * @return TRUE if the platform is headless, FALSE otherwise.
+ */
+B8 Platform_IsHeadless(PlatformState state);
+
 /**
  * Shuts down the platform layer.
  * @param state A PlatformState object, as previous initialized with Platform_Initialize().
@@ -37,7 +71,7 @@ void Platform_Shutdown(PlatformState state);
 B8 Platform_Update(PlatformState state);
 
 /**
- * Get the size of the renderable area.
+ * Get the size of the renderable area. For a headless platform, this is the size of the virtual framebuffer.
  * @param width A pointer where the width will be stored.
  * @param height A pointer where the height will be stored.
  */
@@ -54,11 +88,11 @@ void* Platform_Alloc(size_t bytes);
 /**
  * Allocate a memory block, aligned to a specified offset.
  * @param bytes Size of the desired memory block.
- * @param align The desired alignment.
+ * @param align The desired alignment. Must be a power of two.
  * @return NULL upon failure, otherwise a pointer to the block of memory.
  * @sa Platform_FreeAligned()
  */
-void* Platform_AllocAligned(size_t bytes, U8 align);
+void* Platform_AllocAligned(size_t bytes, size_t align);
 
 /**
  * Reallocate an already-allocated memory block.
@@ -75,7 +109,7 @@ void* Platform_Realloc(void* ptr, size_t bytes);
  * @param bytes The new size of the allocation.
  * @return NULL upon failure, otherwise a pointer to the resized block of memory.
  */
-void* Platform_ReallocAligned(void* ptr, U8 align, size_t bytes);
+void* Platform_ReallocAligned(void* ptr, size_t align, size_t bytes);
 
 /**
  * Free an allocated memory block.
@@ -91,6 +125,90 @@ void Platform_Free(void* ptr);
  */
 void Platform_FreeAligned(void* ptr);
 
+/**
+ * Get the size of a virtual memory page.
+ * @return The page size in bytes.
+ */
+size_t Platform_GetPageSize();
+
+/**
+ * Reserve a range of virtual address space. The range cannot be accessed until it is committed.
+ * @param bytes The number of bytes to reserve. Must be a multiple of the page size.
+ * @return NULL upon failure, otherwise a page-aligned pointer to the start of the range.
+ * @sa Platform_VirtualCommit(), Platform_VirtualRelease()
+ */
+void* Platform_VirtualReserve(size_t bytes);
+
+/**
+ * Back part of a reserved range with memory, making it readable and writable. Newly committed memory is zeroed.
+ * @param ptr A page-aligned pointer within a reserved range.
+ * @param bytes The number of bytes to commit. Must be a multiple of the page size.
+ * @return TRUE on success, FALSE otherwise.
+ */
+B8 Platform_VirtualCommit(void* ptr, size_t bytes);
+
+/**
+ * Return the memory behind part of a reserved range to the operating system, keeping the address space reserved.
+ * @param ptr A page-aligned pointer within a reserved range.
+ * @param bytes The number of bytes to decommit. Must be a multiple of the page size.
+ */
+void Platform_VirtualDecommit(void* ptr, size_t bytes);
+
+/**
+ * Release a reserved range of address space, along with any memory committed within it.
+ * @param ptr A pointer previously returned by Platform_VirtualReserve().
+ * @param bytes The number of bytes originally reserved.
+ */
+void Platform_VirtualRelease(void* ptr, size_t bytes);
+
+/**
+ * Change the access allowed to part of a committed range, without changing its contents.
+ * @param ptr A page-aligned pointer within a committed range.
+ * @param bytes The number of bytes to change. Must be a multiple of the page size.
+ * @param access The access to allow.
+ * @return TRUE on success, FALSE otherwise.
+ */
+B8 Platform_VirtualProtect(void* ptr, size_t bytes, PlatformPageAccess access);
+
+/**
+ * Get the size of a huge page, as used by Platform_AllocHuge() and Platform_VirtualReserveHuge().
+ * @return The huge page size in bytes.
+ */
+size_t Platform_GetHugePageSize();
+
+/**
+ * Allocate a block of memory backed by huge pages where possible. Explicit huge pages are tried first, falling back to
+ * regular pages which may be promoted to huge pages by the operating system.
+ * @param bytes The number of bytes to allocate. Must be a multiple of the huge page size.
+ * @param[out] explicitHuge Set to TRUE if the block is guaranteed to be backed by huge pages, FALSE otherwise.
+ * @return NULL upon allocation failure, otherwise a huge page-aligned pointer to the zero-initialized block.
+ */
+void* Platform_AllocHuge(size_t bytes, B8* explicitHuge);
+
+/**
+ * Free a block of memory allocated with Platform_AllocHuge().
+ * @param ptr A pointer previously returned by Platform_AllocHuge().
+ * @param bytes The number of bytes originally allocated.
+ */
+void Platform_FreeHuge(void* ptr, size_t bytes);
+
+/**
+ * Reserve a range of virtual address space, and ask for memory committed within it to be backed by huge pages where
+ * possible. Release it with Platform_VirtualRelease().
+ * @param bytes The number of bytes to reserve. Must be a multiple of the huge page size.
+ * @return NULL upon failure, otherwise a page-aligned pointer to the start of the range.
+ */
+void* Platform_VirtualReserveHuge(size_t bytes);
+
+/**
+ * Determine how much of a range of memory is currently backed by huge pages which were not explicitly requested. This
+ * may be slow, and should only be used for reporting.
+ * @param ptr A pointer to the start of the range.
+ * @param bytes The size of the range in bytes.
+ * @return The number of bytes within the range that are backed by huge pages.
+ */
+size_t Platform_QueryHugePageBytes(const void* ptr, size_t bytes);
+
 /**
  * Copy an area of memory to another area.
  * @param dst A pointer to the destination of the copy.
@@ -147,3 +265,40 @@ F64 Platform_GetAbsoluteTime();
  * @param ms The number of milliseconds to sleep.
  */
 void Platform_Sleep(U64 ms);
+
+/**
+ * Start running a function on a new thread.
+ * @param fn The function to run.
+ * @param userData A pointer to pass to the function.
+ * @return NULL upon failure, otherwise the new thread, which must be joined with Platform_ThreadJoin().
+ */
+OAPI PlatformThread Platform_ThreadCreate(PlatformThreadFn fn, void* userData);
+
+/**
+ * Wait for a thread's function to return, then release the thread.
+ * @param thread A thread previously returned by Platform_ThreadCreate().
+ */
+OAPI void Platform_ThreadJoin(PlatformThread thread);
+
+/**
+ * Get the number of logical processors available to run threads.
+ * @return The number of logical processors, at least 1.
+ */
+U32 Platform_GetProcessorCount();
+
+/**
+ * Capture the return addresses of the current call stack.
+ * @param[out] frames An array to receive the return addresses, innermost first.
+ * @param maxFrames The maximum number of return addresses to capture.
+ * @param skipFrames The number of frames to skip, not counting this function.
+ * @return The number of return addresses written to frames.
+ */
+U32 Platform_CaptureStackTrace(void** frames, U32 maxFrames, U32 skipFrames);
+
+/**
+ * Write a human-readable description of a code address, such as its symbol or module and offset.
+ * @param address The address to describe.
+ * @param[out] buffer The buffer to write the description to.
+ * @param bufferSize The size of the buffer in bytes.
+ */
+void Platform_DescribeAddress(const void* address, char* buffer, size_t bufferSize);
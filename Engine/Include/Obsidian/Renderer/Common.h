@@ -10,7 +10,9 @@ struct PlatformStateT;
 typedef enum RenderEngineType {
 	RenderEngineType_Vulkan,
 	RenderEngineType_OpenGL,
-	RenderEngineType_DirectX
+	RenderEngineType_DirectX,
+	RenderEngineType_VulkanHeadless, /**< Vulkan rendering to offscreen images, with no surface or swapchain. */
+	RenderEngineType_Null            /**< Performs no rendering or GPU work at all. */
 } RenderEngineType;
 
 /** Contains the information needed to render a frame. */
@@ -19,6 +21,7 @@ typedef struct RenderPacketT {
 } RenderPacket;
 
 struct RenderEngineT {
+	RenderEngineType Type;
 	B8 (*Initialize)(struct RenderEngineT* engine, const char* appName, struct PlatformStateT* platform);
 	void (*Shutdown)(struct RenderEngineT* engine);
 	B8 (*BeginFrame)(struct RenderEngineT* engine, F64 deltaTime);
@@ -0,0 +1,37 @@
+/** @file
+ *  @brief Null render engine, which accepts frames without doing any rendering work */
+#pragma once
+
+#include <Obsidian/Defines.h>
+#include <Obsidian/Renderer/RenderEngine.h>
+
+/**
+ * Initialize the null render engine.
+ * @param engine The RenderEngine object to initialize.
+ * @param appName The name of the application.
+ * @param platform The PlatformState object for the current platform.
+ * @return TRUE on success, FALSE on failure.
+ */
+B8 RenderEngine_Null_Initialize(RenderEngine engine, const char* appName, struct PlatformStateT* platform);
+
+/**
+ * Shut down the null render engine.
+ * @param engine The RenderEngine object to shut down.
+ */
+void RenderEngine_Null_Shutdown(RenderEngine engine);
+
+/**
+ * Begin a new frame.
+ * @param engine The RenderEngine object to use.
+ * @param deltaTime The amount of time, in seconds, since the last render.
+ * @return Always TRUE.
+ */
+B8 RenderEngine_Null_BeginFrame(RenderEngine engine, F64 deltaTime);
+
+/**
+ * End the current frame.
+ * @param engine The RenderEngine object to use.
+ * @param deltaTime The amount of time, in seconds, since the last render.
+ * @return Always TRUE.
+ */
+B8 RenderEngine_Null_EndFrame(RenderEngine engine, F64 deltaTime);
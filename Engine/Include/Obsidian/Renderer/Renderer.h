@@ -10,10 +10,11 @@ struct PlatformStateT;
 /**
  * Initialize the renderer subsystem.
  * @param appName The name of the application.
+ * @param type The render engine type to use.
  * @param platform The current PlatformState object for the platform.
  * @return TRUE on success, FALSE otherwise.
  */
-B8 Renderer_Initialize(const char* appName, struct PlatformStateT* platform);
+B8 Renderer_Initialize(const char* appName, RenderEngineType type, struct PlatformStateT* platform);
 
 /**
  * Shut down the renderer subsystem.
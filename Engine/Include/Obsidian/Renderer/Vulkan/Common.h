@@ -109,6 +109,7 @@ typedef struct VulkanContextT {
 	VulkanFunctions vk;
 	VkAllocationCallbacks Allocator;
 	B8 Validation;
+	B8 Headless;
 
 	VkInstance Instance;
 	VkDebugUtilsMessengerEXT DebugMessenger;
@@ -0,0 +1,215 @@
+#include <Obsidian/Containers/Bitset.h>
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#	define BITSET_SSE2 1
+#	include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#	define BITSET_NEON 1
+#	include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#	include <intrin.h>
+#endif
+
+// Number of bits in each word.
+#define BITSET_WORD_BITS 64
+
+static U64 GetWordCount(U64 bitCount) {
+	return (bitCount + BITSET_WORD_BITS - 1) / BITSET_WORD_BITS;
+}
+
+static U32 CountTrailingZeros(U64 value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+	unsigned long index;
+	_BitScanForward64(&index, value);
+	return index;
+#else
+	return __builtin_ctzll(value);
+#endif
+}
+
+static U32 PopCount(U64 value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+	return (U32) __popcnt64(value);
+#else
+	return __builtin_popcountll(value);
+#endif
+}
+
+// Clear the unused bits of the last word, which must stay clear so whole words can be compared and counted.
+static void Bitset_ClearTail(Bitset* bitset) {
+	const U64 tailBits = bitset->BitCount % BITSET_WORD_BITS;
+	if (tailBits != 0) { bitset->Words[bitset->WordCount - 1] &= ((U64) 1 << tailBits) - 1; }
+}
+
+B8 Bitset_Create(Bitset* bitset, U64 bitCount) {
+	bitset->Words     = NULL;
+	bitset->BitCount  = bitCount;
+	bitset->WordCount = GetWordCount(bitCount);
+	if (bitset->WordCount == 0) { return TRUE; }
+
+	bitset->Words = Memory_Allocate(bitset->WordCount * sizeof(U64), MemoryTag_Bitset);
+	if (bitset->Words == NULL) { return FALSE; }
+	Memory_Zero(bitset->Words, bitset->WordCount * sizeof(U64));
+
+	return TRUE;
+}
+
+void Bitset_Destroy(Bitset* bitset) {
+	Memory_Free(bitset->Words);
+	bitset->Words     = NULL;
+	bitset->BitCount  = 0;
+	bitset->WordCount = 0;
+}
+
+B8 Bitset_Resize(Bitset* bitset, U64 bitCount) {
+	const U64 wordCount = GetWordCount(bitCount);
+	if (wordCount != bitset->WordCount) {
+		U64* words = NULL;
+		if (bitset->Words == NULL) {
+			words = Memory_Allocate(wordCount * sizeof(U64), MemoryTag_Bitset);
+		} else if (wordCount == 0) {
+			Memory_Free(bitset->Words);
+		} else {
+			words = Memory_Reallocate(bitset->Words, wordCount * sizeof(U64));
+		}
+		if (words == NULL && wordCount > 0) { return FALSE; }
+
+		// New words start out clear.
+		if (wordCount > bitset->WordCount) {
+			Memory_Zero(words + bitset->WordCount, (wordCount - bitset->WordCount) * sizeof(U64));
+		}
+		bitset->Words     = words;
+		bitset->WordCount = wordCount;
+	}
+
+	// When shrinking, the bits which are cut off must not come back if the bitset grows again.
+	bitset->BitCount = bitCount;
+	if (wordCount > 0) { Bitset_ClearTail(bitset); }
+
+	return TRUE;
+}
+
+void Bitset_Set(Bitset* bitset, U64 index) {
+	AssertMsg(index < bitset->BitCount, "Bitset index is out of bounds!");
+	bitset->Words[index / BITSET_WORD_BITS] |= (U64) 1 << (index % BITSET_WORD_BITS);
+}
+
+void Bitset_Clear(Bitset* bitset, U64 index) {
+	AssertMsg(index < bitset->BitCount, "Bitset index is out of bounds!");
+	bitset->Words[index / BITSET_WORD_BITS] &= ~((U64) 1 << (index % BITSET_WORD_BITS));
+}
+
+void Bitset_Assign(Bitset* bitset, U64 index, B8 value) {
+	if (value) {
+		Bitset_Set(bitset, index);
+	} else {
+		Bitset_Clear(bitset, index);
+	}
+}
+
+B8 Bitset_Test(const Bitset* bitset, U64 index) {
+	AssertMsg(index < bitset->BitCount, "Bitset index is out of bounds!");
+	return (bitset->Words[index / BITSET_WORD_BITS] >> (index % BITSET_WORD_BITS)) & 1;
+}
+
+void Bitset_Fill(Bitset* bitset, B8 value) {
+	if (bitset->WordCount == 0) { return; }
+
+	Memory_Set(bitset->Words, value ? 0xFF : 0x00, bitset->WordCount * sizeof(U64));
+	Bitset_ClearTail(bitset);
+}
+
+U64 Bitset_Count(const Bitset* bitset) {
+	U64 count = 0;
+	for (U64 i = 0; i < bitset->WordCount; ++i) { count += PopCount(bitset->Words[i]); }
+
+	return count;
+}
+
+U64 Bitset_Next(const Bitset* bitset, U64 index) {
+	if (index >= bitset->BitCount) { return bitset->BitCount; }
+
+	// Ignore the bits of the first word which come before the index, then skip over empty words.
+	U64 wordIndex = index / BITSET_WORD_BITS;
+	U64 word      = bitset->Words[wordIndex] & (~(U64) 0 << (index % BITSET_WORD_BITS));
+	while (word == 0) {
+		if (++wordIndex == bitset->WordCount) { return bitset->BitCount; }
+		word = bitset->Words[wordIndex];
+	}
+
+	return (wordIndex * BITSET_WORD_BITS) + CountTrailingZeros(word);
+}
+
+void Bitset_Copy(Bitset* dst, const Bitset* src) {
+	AssertMsg(dst->BitCount == src->BitCount, "Bitsets must be the same size!");
+	Memory_Copy(dst->Words, src->Words, src->WordCount * sizeof(U64));
+}
+
+void Bitset_And(Bitset* dst, const Bitset* src) {
+	AssertMsg(dst->BitCount == src->BitCount, "Bitsets must be the same size!");
+
+	// Combine two words at a time where we can.
+	U64 i = 0;
+#if BITSET_SSE2 == 1
+	for (; i + 2 <= dst->WordCount; i += 2) {
+		const __m128i a = _mm_loadu_si128((const __m128i*) &dst->Words[i]);
+		const __m128i b = _mm_loadu_si128((const __m128i*) &src->Words[i]);
+		_mm_storeu_si128((__m128i*) &dst->Words[i], _mm_and_si128(a, b));
+	}
+#elif BITSET_NEON == 1
+	for (; i + 2 <= dst->WordCount; i += 2) {
+		vst1q_u64(&dst->Words[i], vandq_u64(vld1q_u64(&dst->Words[i]), vld1q_u64(&src->Words[i])));
+	}
+#endif
+	for (; i < dst->WordCount; ++i) { dst->Words[i] &= src->Words[i]; }
+}
+
+void Bitset_Or(Bitset* dst, const Bitset* src) {
+	AssertMsg(dst->BitCount == src->BitCount, "Bitsets must be the same size!");
+
+	U64 i = 0;
+#if BITSET_SSE2 == 1
+	for (; i + 2 <= dst->WordCount; i += 2) {
+		const __m128i a = _mm_loadu_si128((const __m128i*) &dst->Words[i]);
+		const __m128i b = _mm_loadu_si128((const __m128i*) &src->Words[i]);
+		_mm_storeu_si128((__m128i*) &dst->Words[i], _mm_or_si128(a, b));
+	}
+#elif BITSET_NEON == 1
+	for (; i + 2 <= dst->WordCount; i += 2) {
+		vst1q_u64(&dst->Words[i], vorrq_u64(vld1q_u64(&dst->Words[i]), vld1q_u64(&src->Words[i])));
+	}
+#endif
+	for (; i < dst->WordCount; ++i) { dst->Words[i] |= src->Words[i]; }
+}
+
+void Bitset_AndNot(Bitset* dst, const Bitset* src) {
+	AssertMsg(dst->BitCount == src->BitCount, "Bitsets must be the same size!");
+
+	U64 i = 0;
+#if BITSET_SSE2 == 1
+	for (; i + 2 <= dst->WordCount; i += 2) {
+		const __m128i a = _mm_loadu_si128((const __m128i*) &dst->Words[i]);
+		const __m128i b = _mm_loadu_si128((const __m128i*) &src->Words[i]);
+		// andnot clears the bits of its second operand which are set in its first.
+		_mm_storeu_si128((__m128i*) &dst->Words[i], _mm_andnot_si128(b, a));
+	}
+#elif BITSET_NEON == 1
+	for (; i + 2 <= dst->WordCount; i += 2) {
+		vst1q_u64(&dst->Words[i], vbicq_u64(vld1q_u64(&dst->Words[i]), vld1q_u64(&src->Words[i])));
+	}
+#endif
+	for (; i < dst->WordCount; ++i) { dst->Words[i] &= ~src->Words[i]; }
+}
+
+B8 Bitset_Equal(const Bitset* a, const Bitset* b) {
+	if (a->BitCount != b->BitCount) { return FALSE; }
+	for (U64 i = 0; i < a->WordCount; ++i) {
+		if (a->Words[i] != b->Words[i]) { return FALSE; }
+	}
+
+	return TRUE;
+}
@@ -0,0 +1,408 @@
+#include <Obsidian/Containers/Dictionary.h>
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+#include <Obsidian/Core/String.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#	define DICTIONARY_SSE2 1
+#	include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#	define DICTIONARY_NEON 1
+#	include <arm_neon.h>
+#endif
+
+/**
+ * The dictionary is a Swiss table. Every slot has a control byte, which is either empty, deleted, or holds the low 7
+ * bits of the hash of the slot's key. Lookups compare a whole group of control bytes against the hash at once, and only
+ * compare keys for the slots which match, which almost always is only the slot being looked for.
+ *
+ * Everything lives in a single allocation: the metadata, the values, the keys, and the control bytes. The control
+ * bytes of the first group are repeated after the last slot, so a group can be loaded starting at any slot.
+ */
+typedef struct DictionaryMetadataT {
+	U64 Capacity;            // Number of slots, always a power of two.
+	U64 Size;                // Number of slots holding an entry.
+	U64 Deleted;             // Number of slots holding a tombstone, which count towards the load until the next rehash.
+	U32 KeySize;             // The size of each key.
+	U32 ValueSize;           // The size of each value.
+	DictionaryHashFn Hash;   // Function used to hash keys.
+	DictionaryEqualFn Equal; // Function used to compare keys.
+	void* Keys;              // The keys, indexed by slot.
+	I8* Control;             // The control bytes, indexed by slot.
+} DictionaryMetadata;
+
+// Number of control bytes examined at once.
+#define DICTIONARY_GROUP_WIDTH 16
+
+// Control byte values. Slots holding an entry store 7 bits of its hash, so have the high bit clear.
+static const I8 DictionaryControl_Empty   = (I8) 0x80;
+static const I8 DictionaryControl_Deleted = (I8) 0xFE;
+
+/**
+ * A set of slots within a group, as returned by the Group_Match*() functions. Each slot is represented by a single bit,
+ * spaced 1 << DICTIONARY_GROUP_MASK_SHIFT bits apart.
+ */
+typedef U64 GroupMask;
+#if DICTIONARY_NEON == 1
+#	define DICTIONARY_GROUP_MASK_SHIFT 2
+#else
+#	define DICTIONARY_GROUP_MASK_SHIFT 0
+#endif
+
+// Get a pointer to the dictionary's metadata.
+static DictionaryMetadata* DictionaryGetMetadata(const void* dict) {
+	return (DictionaryMetadata*) (dict - sizeof(DictionaryMetadata));
+}
+
+static size_t AlignUp(size_t value, size_t align) {
+	return (value + align - 1) & ~(align - 1);
+}
+
+// The value and key arrays are kept 16-byte aligned, the same as any other heap allocation.
+static size_t GetKeysOffset(U64 capacity, U32 valueSize) {
+	return AlignUp(capacity * valueSize, 16);
+}
+
+static size_t GetControlOffset(U64 capacity, U32 valueSize, U32 keySize) {
+	return GetKeysOffset(capacity, valueSize) + AlignUp(capacity * keySize, 16);
+}
+
+// Largest number of entries and tombstones a dictionary may hold before it needs to grow, keeping the load at 7/8.
+static U64 GetMaxLoad(U64 capacity) {
+	return capacity - capacity / 8;
+}
+
+// Smallest number of slots able to hold the given number of entries.
+static U64 GetCapacityFor(U64 count) {
+	U64 capacity = DICTIONARY_GROUP_WIDTH;
+	while (GetMaxLoad(capacity) < count) { capacity *= 2; }
+
+	return capacity;
+}
+
+static U32 CountTrailingZeros(U64 value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+	unsigned long index;
+	_BitScanForward64(&index, value);
+	return index;
+#else
+	return __builtin_ctzll(value);
+#endif
+}
+
+static U32 CountLeadingZeros(U64 value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+	unsigned long index;
+	_BitScanReverse64(&index, value);
+	return 63 - index;
+#else
+	return __builtin_clzll(value);
+#endif
+}
+
+// Get the index of the first slot within a mask. The mask must not be empty.
+static U32 GroupMask_First(GroupMask mask) {
+	return CountTrailingZeros(mask) >> DICTIONARY_GROUP_MASK_SHIFT;
+}
+
+// Count the slots at the end of the group which come after the last slot within a mask. The mask must not be empty.
+static U32 GroupMask_CountLast(GroupMask mask) {
+	const U32 unusedBits = 64 - (DICTIONARY_GROUP_WIDTH << DICTIONARY_GROUP_MASK_SHIFT);
+	return (CountLeadingZeros(mask) - unusedBits) >> DICTIONARY_GROUP_MASK_SHIFT;
+}
+
+// Find the slots of a group whose control byte is equal to the given value.
+static GroupMask Group_Match(const I8* group, I8 value) {
+#if DICTIONARY_SSE2 == 1
+	const __m128i ctrl = _mm_loadu_si128((const __m128i*) group);
+	return (U32) _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value)));
+#elif DICTIONARY_NEON == 1
+	// NEON has no movemask, so narrow every byte of the comparison down to 4 bits and keep one bit of each.
+	const uint8x16_t equal = vceqq_s8(vld1q_s8(group), vdupq_n_s8(value));
+	const uint8x8_t narrow = vshrn_n_u16(vreinterpretq_u16_u8(equal), 4);
+	return vget_lane_u64(vreinterpret_u64_u8(narrow), 0) & 0x8888888888888888ull;
+#else
+	GroupMask mask = 0;
+	for (U32 i = 0; i < DICTIONARY_GROUP_WIDTH; ++i) {
+		if (group[i] == value) { mask |= (GroupMask) 1 << i; }
+	}
+	return mask;
+#endif
+}
+
+// Find the slots of a group which are empty or deleted, which are the only control bytes with the high bit set.
+static GroupMask Group_MatchFree(const I8* group) {
+#if DICTIONARY_SSE2 == 1
+	return (U32) _mm_movemask_epi8(_mm_loadu_si128((const __m128i*) group));
+#elif DICTIONARY_NEON == 1
+	const uint8x16_t negative = vcltq_s8(vld1q_s8(group), vdupq_n_s8(0));
+	const uint8x8_t narrow    = vshrn_n_u16(vreinterpretq_u16_u8(negative), 4);
+	return vget_lane_u64(vreinterpret_u64_u8(narrow), 0) & 0x8888888888888888ull;
+#else
+	GroupMask mask = 0;
+	for (U32 i = 0; i < DICTIONARY_GROUP_WIDTH; ++i) {
+		if (group[i] < 0) { mask |= (GroupMask) 1 << i; }
+	}
+	return mask;
+#endif
+}
+
+// Hash bits used to pick the first group to probe.
+static U64 GetProbeStart(U64 hash) {
+	return hash >> 7;
+}
+
+// Hash bits stored in the control byte.
+static I8 GetHashTag(U64 hash) {
+	return (I8) (hash & 0x7F);
+}
+
+static void SetControl(DictionaryMetadata* meta, U64 slot, I8 value) {
+	meta->Control[slot] = value;
+	// Keep the copy of the first group in sync.
+	if (slot < DICTIONARY_GROUP_WIDTH) { meta->Control[meta->Capacity + slot] = value; }
+}
+
+/**
+ * Find the slot holding the given key. Groups are probed with triangular steps, which visit every group of a
+ * power-of-two table, until the key is found or a group with an empty slot shows it can't be any further along.
+ * @return The slot holding the key, or the dictionary's capacity if it is not present.
+ */
+static U64 FindSlot(const DictionaryMetadata* meta, const void* key, U64 hash) {
+	const U64 mask = meta->Capacity - 1;
+	const I8 tag   = GetHashTag(hash);
+	U64 position   = GetProbeStart(hash) & mask;
+	for (U64 step = DICTIONARY_GROUP_WIDTH; step <= meta->Capacity; step += DICTIONARY_GROUP_WIDTH) {
+		const I8* group = meta->Control + position;
+		for (GroupMask match = Group_Match(group, tag); match; match &= match - 1) {
+			const U64 slot = (position + GroupMask_First(match)) & mask;
+			if (meta->Equal(meta->Keys + (slot * meta->KeySize), key)) { return slot; }
+		}
+		if (Group_Match(group, DictionaryControl_Empty)) { break; }
+		position = (position + step) & mask;
+	}
+
+	return meta->Capacity;
+}
+
+// Find the first empty or deleted slot along the probe sequence of a hash.
+static U64 FindFreeSlot(const DictionaryMetadata* meta, U64 hash) {
+	const U64 mask = meta->Capacity - 1;
+	U64 position   = GetProbeStart(hash) & mask;
+	for (U64 step = DICTIONARY_GROUP_WIDTH;; step += DICTIONARY_GROUP_WIDTH) {
+		const GroupMask free = Group_MatchFree(meta->Control + position);
+		if (free) { return (position + GroupMask_First(free)) & mask; }
+		position = (position + step) & mask;
+	}
+}
+
+// Allocate a dictionary with the given number of slots and no entries.
+static void* DictionaryAllocate(
+	U64 capacity, U32 keySize, U32 valueSize, DictionaryHashFn hash, DictionaryEqualFn equal) {
+	const size_t metadataSize  = sizeof(DictionaryMetadata);
+	const size_t controlOffset = GetControlOffset(capacity, valueSize, keySize);
+	const size_t totalSize     = metadataSize + controlOffset + capacity + DICTIONARY_GROUP_WIDTH;
+
+	void* block = Memory_Allocate(totalSize, MemoryTag_Dictionary);
+	if (block == NULL) { return NULL; }
+
+	void* returnPtr          = block + metadataSize;
+	DictionaryMetadata* meta = DictionaryGetMetadata(returnPtr);
+	meta->Capacity           = capacity;
+	meta->Size               = 0;
+	meta->Deleted            = 0;
+	meta->KeySize            = keySize;
+	meta->ValueSize          = valueSize;
+	meta->Hash               = hash;
+	meta->Equal              = equal;
+	meta->Keys               = returnPtr + GetKeysOffset(capacity, valueSize);
+	meta->Control            = returnPtr + controlOffset;
+	Memory_Set(meta->Control, (U8) DictionaryControl_Empty, capacity + DICTIONARY_GROUP_WIDTH);
+
+	return returnPtr;
+}
+
+// Move every entry into a new table with the given number of slots, dropping any tombstones.
+static B8 DictionaryRehash(DictionaryT dict, U64 capacity) {
+	const DictionaryMetadata* meta = DictionaryGetMetadata(*dict);
+	void* newDict = DictionaryAllocate(capacity, meta->KeySize, meta->ValueSize, meta->Hash, meta->Equal);
+	if (newDict == NULL) { return FALSE; }
+
+	DictionaryMetadata* newMeta = DictionaryGetMetadata(newDict);
+	for (U64 slot = 0; slot < meta->Capacity; ++slot) {
+		if (meta->Control[slot] < 0) { continue; }
+
+		const void* key = meta->Keys + (slot * meta->KeySize);
+		const U64 hash  = meta->Hash(key);
+		const U64 dest  = FindFreeSlot(newMeta, hash);
+		SetControl(newMeta, dest, GetHashTag(hash));
+		Memory_Copy(newMeta->Keys + (dest * meta->KeySize), key, meta->KeySize);
+		Memory_Copy(newDict + (dest * meta->ValueSize), (*dict) + (slot * meta->ValueSize), meta->ValueSize);
+	}
+	newMeta->Size = meta->Size;
+
+	Memory_Free(DictionaryGetMetadata(*dict));
+	*dict = newDict;
+
+	return TRUE;
+}
+
+void* _Dictionary_Create(U64 keySize, U64 valueSize, U64 capacity, DictionaryHashFn hash, DictionaryEqualFn equal) {
+	AssertMsg(hash && equal, "Dictionaries need a hash and an equality function!");
+
+	return DictionaryAllocate(GetCapacityFor(capacity), keySize, valueSize, hash, equal);
+}
+
+void _Dictionary_Destroy(DictionaryT dict) {
+	// Pointer to the start of metadata is the same pointer we originally allocated.
+	Memory_Free(DictionaryGetMetadata(*dict));
+}
+
+U64 _Dictionary_Size(ConstDictionaryT dict) {
+	Assert(dict && *dict);
+
+	return DictionaryGetMetadata(*dict)->Size;
+}
+
+U64 _Dictionary_Capacity(ConstDictionaryT dict) {
+	Assert(dict && *dict);
+
+	return DictionaryGetMetadata(*dict)->Capacity;
+}
+
+B8 _Dictionary_Reserve(DictionaryT dict, U64 count) {
+	Assert(dict && *dict);
+	const DictionaryMetadata* meta = DictionaryGetMetadata(*dict);
+
+	if (GetMaxLoad(meta->Capacity) - meta->Deleted >= count) { return TRUE; }
+
+	return DictionaryRehash(dict, GetCapacityFor(count));
+}
+
+void* _Dictionary_Insert(DictionaryT dict, const void* key, const void* value) {
+	Assert(dict && *dict);
+	DictionaryMetadata* meta = DictionaryGetMetadata(*dict);
+
+	// Replace the value of an existing entry.
+	const U64 hash = meta->Hash(key);
+	U64 slot       = FindSlot(meta, key, hash);
+	if (slot < meta->Capacity) {
+		void* ptr = (*dict) + (slot * meta->ValueSize);
+		if (value) { Memory_Copy(ptr, value, meta->ValueSize); }
+		return ptr;
+	}
+
+	// Make room for the new entry. If most of the load is tombstones, rehashing at the same size is enough to clear
+	// them out.
+	if (meta->Size + meta->Deleted + 1 > GetMaxLoad(meta->Capacity)) {
+		const U64 capacity = meta->Size + 1 > GetMaxLoad(meta->Capacity) / 2 ? meta->Capacity * 2 : meta->Capacity;
+		if (!DictionaryRehash(dict, capacity)) {
+			LogE("[Dictionary] Failed to grow dictionary to %llu slots!", capacity);
+			return NULL;
+		}
+		meta = DictionaryGetMetadata(*dict);
+	}
+
+	slot = FindFreeSlot(meta, hash);
+	if (meta->Control[slot] == DictionaryControl_Deleted) { meta->Deleted--; }
+	SetControl(meta, slot, GetHashTag(hash));
+	meta->Size++;
+
+	Memory_Copy(meta->Keys + (slot * meta->KeySize), key, meta->KeySize);
+	void* ptr = (*dict) + (slot * meta->ValueSize);
+	if (value) {
+		Memory_Copy(ptr, value, meta->ValueSize);
+	} else {
+		Memory_Zero(ptr, meta->ValueSize);
+	}
+
+	return ptr;
+}
+
+void* _Dictionary_Find(ConstDictionaryT dict, const void* key) {
+	Assert(dict && *dict);
+	const DictionaryMetadata* meta = DictionaryGetMetadata(*dict);
+
+	const U64 slot = FindSlot(meta, key, meta->Hash(key));
+	if (slot == meta->Capacity) { return NULL; }
+
+	return (void*) (*dict) + (slot * meta->ValueSize);
+}
+
+B8 _Dictionary_Remove(DictionaryT dict, const void* key, void* value) {
+	Assert(dict && *dict);
+	DictionaryMetadata* meta = DictionaryGetMetadata(*dict);
+
+	const U64 slot = FindSlot(meta, key, meta->Hash(key));
+	if (slot == meta->Capacity) { return FALSE; }
+
+	if (value != NULL) { Memory_Copy(value, (*dict) + (slot * meta->ValueSize), meta->ValueSize); }
+
+	// Lookups stop at the first group with an empty slot, so a slot may only become empty again if every group it is
+	// part of already has an empty slot. Otherwise it becomes a tombstone, which lookups probe past.
+	const GroupMask after  = Group_Match(meta->Control + slot, DictionaryControl_Empty);
+	const GroupMask before = Group_Match(meta->Control + ((slot - DICTIONARY_GROUP_WIDTH) & (meta->Capacity - 1)),
+	                                     DictionaryControl_Empty);
+	if (after && before && GroupMask_First(after) + GroupMask_CountLast(before) < DICTIONARY_GROUP_WIDTH) {
+		SetControl(meta, slot, DictionaryControl_Empty);
+	} else {
+		SetControl(meta, slot, DictionaryControl_Deleted);
+		meta->Deleted++;
+	}
+	meta->Size--;
+
+	return TRUE;
+}
+
+void _Dictionary_Clear(DictionaryT dict) {
+	Assert(dict && *dict);
+	DictionaryMetadata* meta = DictionaryGetMetadata(*dict);
+
+	Memory_Set(meta->Control, (U8) DictionaryControl_Empty, meta->Capacity + DICTIONARY_GROUP_WIDTH);
+	meta->Size    = 0;
+	meta->Deleted = 0;
+}
+
+U64 _Dictionary_Next(ConstDictionaryT dict, U64 slot) {
+	Assert(dict && *dict);
+	const DictionaryMetadata* meta = DictionaryGetMetadata(*dict);
+
+	while (slot < meta->Capacity && meta->Control[slot] < 0) { ++slot; }
+
+	return slot;
+}
+
+const void* _Dictionary_KeyAt(ConstDictionaryT dict, U64 slot) {
+	Assert(dict && *dict);
+	const DictionaryMetadata* meta = DictionaryGetMetadata(*dict);
+
+	AssertMsg(slot < meta->Capacity && meta->Control[slot] >= 0, "Dictionary slot does not hold an entry!");
+
+	return meta->Keys + (slot * meta->KeySize);
+}
+
+U64 Dictionary_HashString(const void* key) {
+	// FNV-1a, finished by folding the high bits down, as the low bits of FNV only depend on the low bits of each byte.
+	const U64 hash = String_Hash64(*(const char* const*) key);
+
+	return hash ^ (hash >> 32);
+}
+
+B8 Dictionary_EqualString(const void* a, const void* b) {
+	return String_Equal(*(const char* const*) a, *(const char* const*) b);
+}
+
+U64 Dictionary_HashInt(const void* key) {
+	// The SplitMix64 finalizer, so that keys which only differ in their high bits still land in different groups.
+	U64 hash = *(const U64*) key;
+	hash ^= hash >> 30;
+	hash *= 0xBF58476D1CE4E5B9ull;
+	hash ^= hash >> 27;
+	hash *= 0x94D049BB133111EBull;
+
+	return hash ^ (hash >> 31);
+}
+
+B8 Dictionary_EqualInt(const void* a, const void* b) {
+	return *(const U64*) a == *(const U64*) b;
+}
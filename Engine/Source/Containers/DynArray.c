@@ -1,22 +1,71 @@
 #include <Obsidian/Containers/DynArray.h>
 #include <Obsidian/Core/Logger.h>
 #include <Obsidian/Core/Memory.h>
+#include <Obsidian/Core/VirtualArena.h>
+#include <Obsidian/Platform/Platform.h>
+#include <stdint.h>
 
 typedef struct DynArrayMetadataT {
-	U64 Capacity;  // Amount of elements the array has memory for.
-	U64 Size;      // Amount of elements the array currently contains.
-	U64 Stride;    // The size of each element.
+	U64 Capacity;     // Amount of elements the array has memory for.
+	U64 Size;         // Amount of elements the array currently contains.
+	U32 Stride;       // The size of each element.
+	U32 Flags;        // Where the array's memory comes from and how it grows, see DynArrayFlag_*.
+	U64 MaxCapacity;  // For arrays backed by virtual memory, the amount of elements address space is reserved for.
 } DynArrayMetadata;
 
-// If we attempt to push to a dynamic array with no remaining capacity, mutltiply the capacity by this number.
-static const F32 DynArrayResizeFactor = 1.5f;
+STATIC_ASSERT(sizeof(DynArrayMetadata) == DYNARRAY_HEADER_SIZE, "Expected DYNARRAY_HEADER_SIZE to match the metadata.");
+
+// The array lives on a thread's scratch allocator, and its memory is released with the scratch scope.
+static const U32 DynArrayFlag_Scratch = 1 << 0;
+// The array lives in storage provided by the caller, which it leaves for the heap once it outgrows it.
+static const U32 DynArrayFlag_Inline = 1 << 1;
+// The array lives in its own virtual arena, and grows by committing more of it.
+static const U32 DynArrayFlag_Virtual = 1 << 2;
+
+// The array's DynArrayGrowth policy is stored in these bits of its flags.
+static const U32 DynArrayFlag_GrowthShift = 8;
+static const U32 DynArrayFlag_GrowthMask  = 0xFF << 8;
+
+// When an array runs out of capacity, it grows by at least this many elements, so that small arrays don't reallocate
+// on every push.
+static const U64 DynArrayMinimumGrowth = 4;
 
 // Get a pointer to the dynamic array's metadata.
 static DynArrayMetadata* DynArrayGetMetadata(const void* dynArray) {
 	return (DynArrayMetadata*) (dynArray - sizeof(DynArrayMetadata));
 }
 
+// Virtual arrays keep their arena at the start of their reservation, followed by the metadata and then the elements.
+// The elements are kept 16-byte aligned, the same as heap arrays.
+static size_t DynArrayGetVirtualHeaderSize() {
+	return (sizeof(VirtualArena) + sizeof(DynArrayMetadata) + 15) & ~(size_t) 15;
+}
+
+// Get a pointer to a virtual array's arena. The headers are smaller than a page, so the arena is at the start of the
+// page the metadata is in.
+static VirtualArena* DynArrayGetArena(DynArrayMetadata* meta) {
+	return (VirtualArena*) ((uintptr_t) meta & ~(uintptr_t) (Platform_GetPageSize() - 1));
+}
+
+// Get the capacity a heap array will have when allocated to hold the given number of elements. The heap rounds blocks
+// up internally, so the array may as well use all of the memory it is given.
+static U64 DynArrayGetHeapCapacity(U64 stride, U64 elementCount) {
+	const size_t metadataSize = sizeof(DynArrayMetadata);
+	const size_t blockSize    = Memory_GetGoodSize(metadataSize + (stride * elementCount), MemoryTag_DynamicArray);
+
+	return (blockSize - metadataSize) / stride;
+}
+
+// Set a virtual array's capacity to make use of all of its committed memory.
+static void DynArrayUpdateVirtualCapacity(DynArrayMetadata* meta) {
+	const VirtualArena* arena = DynArrayGetArena(meta);
+	const U64 capacity        = (arena->Committed - DynArrayGetVirtualHeaderSize()) / meta->Stride;
+	meta->Capacity            = capacity < meta->MaxCapacity ? capacity : meta->MaxCapacity;
+}
+
 void* _DynArray_Create(U64 elementSize, U64 elementCount) {
+	AssertMsg(elementSize <= 0xFFFFFFFF, "DynArray element size must fit in 32 bits!");
+	elementCount              = DynArrayGetHeapCapacity(elementSize, elementCount);
 	const size_t metadataSize = sizeof(DynArrayMetadata);
 	const size_t arraySize    = elementSize * elementCount;
 	const size_t totalSize    = metadataSize + arraySize;
@@ -33,9 +82,95 @@ void* _DynArray_Create(U64 elementSize, U64 elementCount) {
 	DynArrayMetadata* meta = DynArrayGetMetadata(returnPtr);
 
 	// Update our metadata.
-	meta->Capacity = elementCount;
-	meta->Size     = 0;
-	meta->Stride   = elementSize;
+	meta->Capacity    = elementCount;
+	meta->Size        = 0;
+	meta->Stride      = elementSize;
+	meta->Flags       = 0;
+	meta->MaxCapacity = 0;
+
+	return returnPtr;
+}
+
+void* _DynArray_CreateScratch(U64 elementSize, U64 elementCount) {
+	AssertMsg(elementSize <= 0xFFFFFFFF, "DynArray element size must fit in 32 bits!");
+	const size_t metadataSize = sizeof(DynArrayMetadata);
+	const size_t arraySize    = elementSize * elementCount;
+	const size_t totalSize    = metadataSize + arraySize;
+
+	void* dynArray = Memory_ScratchAlloc(totalSize);
+	if (dynArray == NULL) { return NULL; }
+
+	// Scratch memory may be reused, so it needs zeroing just like heap memory.
+	Memory_Zero(dynArray, totalSize);
+
+	void* returnPtr        = dynArray + metadataSize;
+	DynArrayMetadata* meta = DynArrayGetMetadata(returnPtr);
+	meta->Capacity         = elementCount;
+	meta->Size             = 0;
+	meta->Stride           = elementSize;
+	meta->Flags            = DynArrayFlag_Scratch;
+	meta->MaxCapacity      = 0;
+
+	return returnPtr;
+}
+
+void* _DynArray_CreateScratchSized(U64 elementSize, U64 elementCount) {
+	void* dynArray = _DynArray_CreateScratch(elementSize, elementCount);
+	if (dynArray) { _DynArray_Resize(&dynArray, elementCount); }
+
+	return dynArray;
+}
+
+void* _DynArray_CreateVirtual(U64 elementSize, U64 maxElementCount) {
+	AssertMsg(elementSize <= 0xFFFFFFFF, "DynArray element size must fit in 32 bits!");
+	if (maxElementCount == 0) {
+		LogE("[DynArray] Cannot create a virtual array with room for no elements!");
+		return NULL;
+	}
+
+	const size_t headerSize = DynArrayGetVirtualHeaderSize();
+
+	VirtualArena arena;
+	if (!VirtualArena_Create(&arena, headerSize + (elementSize * maxElementCount), MemoryTag_DynamicArray)) {
+		return NULL;
+	}
+
+	// Commit our headers, along with room for the default number of elements.
+	const U64 initialCount = maxElementCount < DynArray_DefaultCapacity ? maxElementCount : DynArray_DefaultCapacity;
+	if (!VirtualArena_SetUsed(&arena, headerSize + (elementSize * initialCount))) {
+		VirtualArena_Destroy(&arena);
+		return NULL;
+	}
+
+	// Move the arena into its own memory. From here on, we only touch it in place.
+	Memory_Copy(arena.Base, &arena, sizeof(VirtualArena));
+
+	// Freshly committed memory is already zeroed, so we only need to fill in our metadata.
+	void* returnPtr        = arena.Base + headerSize;
+	DynArrayMetadata* meta = DynArrayGetMetadata(returnPtr);
+	meta->Size             = 0;
+	meta->Stride           = elementSize;
+	meta->Flags            = DynArrayFlag_Virtual;
+	meta->MaxCapacity      = maxElementCount;
+	DynArrayUpdateVirtualCapacity(meta);
+
+	return returnPtr;
+}
+
+void* _DynArray_CreateInline(U64 elementSize, void* storage, U64 storageSize) {
+	const size_t metadataSize = sizeof(DynArrayMetadata);
+	AssertMsg(elementSize <= 0xFFFFFFFF, "DynArray element size must fit in 32 bits!");
+	AssertMsg(((uintptr_t) storage & 15) == 0, "DynArray inline storage must be 16-byte aligned!");
+	AssertMsg(storageSize >= metadataSize, "DynArray inline storage is too small to hold its metadata!");
+
+	// Only the metadata needs initializing. The elements are zeroed as the array grows, like any other array.
+	void* returnPtr        = storage + metadataSize;
+	DynArrayMetadata* meta = DynArrayGetMetadata(returnPtr);
+	meta->Capacity         = (storageSize - metadataSize) / elementSize;
+	meta->Size             = 0;
+	meta->Stride           = elementSize;
+	meta->Flags            = DynArrayFlag_Inline;
+	meta->MaxCapacity      = 0;
 
 	return returnPtr;
 }
@@ -50,6 +185,16 @@ void* _DynArray_CreateSized(U64 elementSize, U64 elementCount) {
 void _DynArray_Destroy(DynArrayT dynArray) {
 	DynArrayMetadata* meta = DynArrayGetMetadata(*dynArray);
 
+	// Scratch arrays are released along with the rest of their scratch scope, and inline arrays belong to the caller.
+	if (meta->Flags & (DynArrayFlag_Scratch | DynArrayFlag_Inline)) { return; }
+
+	if (meta->Flags & DynArrayFlag_Virtual) {
+		// Copy the arena out first, as it is stored in the memory it releases.
+		VirtualArena arena = *DynArrayGetArena(meta);
+		VirtualArena_Destroy(&arena);
+		return;
+	}
+
 	// Pointer to the start of metadata is the same pointer we originally allocated.
 	Memory_Free(meta);
 }
@@ -75,23 +220,50 @@ U64 _DynArray_Stride(ConstDynArrayT dynArray) {
 	return meta->Stride;
 }
 
+void _DynArray_SetGrowth(DynArrayT dynArray, DynArrayGrowth growth) {
+	Assert(dynArray && *dynArray);
+	DynArrayMetadata* meta = DynArrayGetMetadata(*dynArray);
+
+	meta->Flags = (meta->Flags & ~DynArrayFlag_GrowthMask) | ((U32) growth << DynArrayFlag_GrowthShift);
+}
+
 B8 _DynArray_Trim(DynArrayT dynArray) {
 	Assert(dynArray && *dynArray);
 	DynArrayMetadata* meta = DynArrayGetMetadata(*dynArray);
 
-	// If capacity equals size already, there's nothing we need to do!
-	if (meta->Capacity == meta->Size) { return TRUE; }
+	// If capacity equals size already, there's nothing we need to do! Inline storage can't shrink either.
+	if (meta->Capacity == meta->Size || (meta->Flags & DynArrayFlag_Inline)) { return TRUE; }
+
+	if (meta->Flags & DynArrayFlag_Virtual) {
+		// Virtual arrays stay in place, and return their unused pages to the operating system.
+		VirtualArena* arena = DynArrayGetArena(meta);
+		VirtualArena_SetUsed(arena, DynArrayGetVirtualHeaderSize() + (meta->Stride * meta->Size));
+		VirtualArena_Trim(arena);
+		DynArrayUpdateVirtualCapacity(meta);
+
+		return TRUE;
+	}
+
+	// Heap arrays keep whatever their block is rounded up to anyway.
+	const B8 scratch      = (meta->Flags & DynArrayFlag_Scratch) != 0;
+	const U64 newCapacity = scratch ? meta->Size : DynArrayGetHeapCapacity(meta->Stride, meta->Size);
+	if (newCapacity >= meta->Capacity) { return TRUE; }
 
 	const size_t metadataSize = sizeof(DynArrayMetadata);
-	const size_t arraySize    = meta->Stride * meta->Size;
+	const size_t arraySize    = meta->Stride * newCapacity;
 	const size_t totalSize    = metadataSize + arraySize;
 
-	DynArrayMetadata* newMeta = Memory_Reallocate(meta, totalSize);
+	DynArrayMetadata* newMeta = NULL;
+	if (scratch) {
+		newMeta = Memory_ScratchRealloc(meta, metadataSize + (meta->Stride * meta->Capacity), totalSize);
+	} else {
+		newMeta = Memory_Reallocate(meta, totalSize);
+	}
 	// If we fail to reallocate, we return NULL here. The original dynamic array is still valid.
 	if (newMeta == NULL) { return FALSE; }
 
 	// Update metadata.
-	newMeta->Capacity = newMeta->Size;
+	newMeta->Capacity = newCapacity;
 	// Careful of the pointer arithmetic.
 	*dynArray = ((void*) newMeta) + metadataSize;
 
@@ -133,94 +305,176 @@ B8 _DynArray_Reserve(DynArrayT dynArray, U64 elementCount) {
 	// Only reallocate if the requested size is larger than current. Shrinking must be handled by _DynArray_Trim().
 	if (meta->Capacity >= elementCount) { return TRUE; }
 
+	if (meta->Flags & DynArrayFlag_Virtual) {
+		// Virtual arrays grow in place by committing more of their reservation.
+		if (elementCount > meta->MaxCapacity) {
+			LogE("[DynArray] Cannot grow virtual array to %llu elements, only %llu are reserved!",
+			     elementCount,
+			     meta->MaxCapacity);
+			return FALSE;
+		}
+		if (!VirtualArena_SetUsed(DynArrayGetArena(meta), DynArrayGetVirtualHeaderSize() + (meta->Stride * elementCount))) {
+			return FALSE;
+		}
+		DynArrayUpdateVirtualCapacity(meta);
+
+		return TRUE;
+	}
+
+	// Heap arrays make use of all of the memory the heap rounds their block up to.
+	const B8 scratch          = (meta->Flags & DynArrayFlag_Scratch) != 0;
+	const U64 newCapacity     = scratch ? elementCount : DynArrayGetHeapCapacity(meta->Stride, elementCount);
 	const size_t metadataSize = sizeof(DynArrayMetadata);
-	const size_t arraySize    = meta->Stride * elementCount;
+	const size_t arraySize    = meta->Stride * newCapacity;
 	const size_t totalSize    = metadataSize + arraySize;
 
-	DynArrayMetadata* newMeta = Memory_Reallocate(meta, totalSize);
+	// Scratch arrays grow in place when they are the most recent scratch allocation, and are copied otherwise.
+	DynArrayMetadata* newMeta = NULL;
+	if (scratch) {
+		newMeta = Memory_ScratchRealloc(meta, metadataSize + (meta->Stride * meta->Capacity), totalSize);
+	} else if (meta->Flags & DynArrayFlag_Inline) {
+		// Inline arrays spill over to the heap, leaving their storage behind.
+		newMeta = Memory_Allocate(totalSize, MemoryTag_DynamicArray);
+		if (newMeta) {
+			Memory_Copy(newMeta, meta, metadataSize + (meta->Stride * meta->Size));
+			newMeta->Flags &= ~DynArrayFlag_Inline;
+		}
+	} else {
+		newMeta = Memory_Reallocate(meta, totalSize);
+	}
 	if (newMeta == NULL) { return FALSE; }
 
-	newMeta->Capacity = elementCount;
+	newMeta->Capacity = newCapacity;
 	*dynArray         = ((void*) newMeta) + metadataSize;
 
 	return TRUE;
 }
 
-void _DynArray_Push(DynArrayT dynArray, const void* element) {
+// Ensure the dynamic array can hold the given number of elements. Growth is geometric unless the array asks otherwise,
+// so that many insertions back-to-back only reallocate a handful of times, and a batch of insertions grows the array
+// at most once.
+static B8 DynArrayGrow(DynArrayT dynArray, U64 elementCount) {
+	DynArrayMetadata* meta = DynArrayGetMetadata(*dynArray);
+	if (meta->Capacity >= elementCount) { return TRUE; }
+
+	// Determine our new size from the array's growth policy. This is done in integers, as floats can't represent every
+	// capacity of very large arrays.
+	const DynArrayGrowth growth = (meta->Flags & DynArrayFlag_GrowthMask) >> DynArrayFlag_GrowthShift;
+	U64 newCount                = elementCount;
+	if (growth == DynArrayGrowth_Default) {
+		const U64 step = meta->Capacity / 2;
+		newCount       = meta->Capacity + (step > DynArrayMinimumGrowth ? step : DynArrayMinimumGrowth);
+	} else if (growth == DynArrayGrowth_PowerOfTwo) {
+		newCount = DynArrayMinimumGrowth;
+		while (newCount < elementCount && newCount < ((U64) 1 << 63)) { newCount <<= 1; }
+	}
+	// Virtual arrays cannot grow past their reservation, but may still have room to grow a little.
+	if ((meta->Flags & DynArrayFlag_Virtual) && newCount > meta->MaxCapacity) { newCount = meta->MaxCapacity; }
+	// We may need even more room than that, such as when inserting many elements at once.
+	if (newCount < elementCount) { newCount = elementCount; }
+
+	return _DynArray_Reserve(dynArray, newCount);
+}
+
+B8 _DynArray_Push(DynArrayT dynArray, const void* element) {
 	Assert(dynArray && *dynArray);
 	DynArrayMetadata* meta = DynArrayGetMetadata(*dynArray);
 
 	// Simply use the insert function to insert at the end of the array.
-	_DynArray_Insert(dynArray, meta->Size, element);
+	if (!_DynArray_InsertRange(dynArray, meta->Size, element, 1)) {
+		LogE("[DynArray] Failed to grow array to push element %llu!", meta->Size);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+B8 _DynArray_PushMany(DynArrayT dynArray, const void* elements, U64 count) {
+	Assert(dynArray && *dynArray);
+	DynArrayMetadata* meta = DynArrayGetMetadata(*dynArray);
+
+	return _DynArray_InsertRange(dynArray, meta->Size, elements, count);
 }
 
 void _DynArray_Pop(DynArrayT dynArray, void* element) {
 	Assert(dynArray && *dynArray);
 	DynArrayMetadata* meta = DynArrayGetMetadata(*dynArray);
 
+	AssertMsg(meta->Size > 0, "Attempting to pop from empty DynArray!");
+
 	// Use the extract function to take from the end of the array.
-	_DynArray_Extract(dynArray, meta->Size - 1, element);
+	_DynArray_ExtractRange(dynArray, meta->Size - 1, 1, element);
+}
+
+B8 _DynArray_Insert(DynArrayT dynArray, U64 index, const void* element) {
+	return _DynArray_InsertRange(dynArray, index, element, 1);
 }
 
-void _DynArray_Insert(DynArrayT dynArray, U64 index, const void* element) {
+B8 _DynArray_InsertRange(DynArrayT dynArray, U64 index, const void* elements, U64 count) {
 	Assert(dynArray && *dynArray);
 	DynArrayMetadata* meta = DynArrayGetMetadata(*dynArray);
 
 	AssertMsg(index <= meta->Size, "DynArray insertion index is out of bounds!");
+	if (count == 0) { return TRUE; }
 
 	// First ensure we have the capacity to insert into the array.
-	if (meta->Capacity <= meta->Size) {
-		// If not, use the resize factor to determine our new size. The resize factor is used rather than simply
-		// incrementing by one to reduce the number of copies needed during times of many insertions back-to-back.
-		U64 newCount = (F32) meta->Capacity * DynArrayResizeFactor;
-		// Because of integer rounding, it is possible that the previous multiplication returns the exact same capacity.
-		// Therefore, we need to make sure we at least increase by 1 no matter what.
-		if (newCount == meta->Capacity) { newCount = meta->Capacity + 1; }
-		const B8 resized = _DynArray_Reserve(dynArray, newCount);
-		if (!resized) { return; }
-		// Update metadata since we have reallocated.
-		meta = DynArrayGetMetadata(*dynArray);
-	}
+	if (!DynArrayGrow(dynArray, meta->Size + count)) { return FALSE; }
+	// Update metadata since we may have reallocated.
+	meta = DynArrayGetMetadata(*dynArray);
 
 	// If we're not inserting at the very end of the array, we need to shift all of the existing values to make room.
-	if (index <= (meta->Size - 1)) {
-		const U64 indexCount     = meta->Size - index;                    // Number of indices that need to shift
-		const size_t bytesToMove = indexCount * meta->Stride;             // Bytes those indices take up
-		void* oldPosition        = (*dynArray) + (index * meta->Stride);  // Pointer to the first index that needs to move
-		void* newPosition        = oldPosition + meta->Stride;            // Pointer to the new first index's location
-		Memory_Move(newPosition, oldPosition, bytesToMove);  // Memory Move is required as the two blocks overlap
+	void* insertPosition = (*dynArray) + (index * meta->Stride);
+	if (index < meta->Size) {
+		const size_t bytesToMove = (meta->Size - index) * meta->Stride;  // Bytes the shifted indices take up
+		void* newPosition        = insertPosition + (count * meta->Stride);
+		Memory_Move(newPosition, insertPosition, bytesToMove);  // Memory Move is required as the two blocks overlap
 	}
 
-	// Finally, copy in our new value.
-	void* ptr = (*dynArray) + (meta->Stride * index);
-	Memory_Copy(ptr, element, meta->Stride);
+	// Finally, copy in our new values.
+	Memory_Copy(insertPosition, elements, count * meta->Stride);
+
+	meta->Size += count;
 
-	meta->Size++;
+	return TRUE;
 }
 
 void _DynArray_Extract(DynArrayT dynArray, U64 index, void* element) {
+	_DynArray_ExtractRange(dynArray, index, 1, element);
+}
+
+void _DynArray_ExtractRange(DynArrayT dynArray, U64 index, U64 count, void* elements) {
 	Assert(dynArray && *dynArray);
 	DynArrayMetadata* meta = DynArrayGetMetadata(*dynArray);
 
-	AssertMsg(meta->Size > 0, "Attempting to extract from empty DynArray!");
-	AssertMsg(index < meta->Size, "DynArray extraction index is out of bounds!");
+	AssertMsg(index <= meta->Size && count <= meta->Size - index, "DynArray extraction range is out of bounds!");
+	if (count == 0) { return; }
 
-	if (element != NULL) {
-		const void* ptr = (*dynArray) + (meta->Stride * index);
-		Memory_Copy(element, ptr, meta->Stride);
-	}
+	void* extractPosition = (*dynArray) + (index * meta->Stride);
+	if (elements != NULL) { Memory_Copy(elements, extractPosition, count * meta->Stride); }
 
-	// If we didn't pop from the end of the array, we need to shift all the existing values back to fill the gap.
-	if (index < (meta->Size - 1)) {
-		const U64 firstIndex     = index + 1;                           // First index that needs to move
-		const U64 indexCount     = meta->Size - index - 1;              // Number of indices that need to move
-		const size_t bytesToMove = indexCount * meta->Stride;           // Bytes those indices take up
-		void* oldPosition = (*dynArray) + (firstIndex * meta->Stride);  // Pointer to the first index that needs to move
-		void* newPosition = oldPosition - meta->Stride;                 // Pointer to the new first index's location
-		Memory_Copy(newPosition,
-		            oldPosition,
-		            bytesToMove);  // Memory Move is not required here because the destination is located before the source
+	// If we didn't extract from the end of the array, we need to shift all the existing values back to fill the gap.
+	const U64 firstIndex = index + count;  // First index that needs to move
+	if (firstIndex < meta->Size) {
+		const size_t bytesToMove = (meta->Size - firstIndex) * meta->Stride;  // Bytes those indices take up
+		void* oldPosition        = extractPosition + (count * meta->Stride);
+		Memory_Move(extractPosition, oldPosition, bytesToMove);  // Memory Move is required as the two blocks may overlap
 	}
 
+	meta->Size -= count;
+}
+
+void _DynArray_SwapRemove(DynArrayT dynArray, U64 index, void* element) {
+	Assert(dynArray && *dynArray);
+	DynArrayMetadata* meta = DynArrayGetMetadata(*dynArray);
+
+	AssertMsg(index < meta->Size, "DynArray removal index is out of bounds!");
+
+	void* ptr = (*dynArray) + (index * meta->Stride);
+	if (element != NULL) { Memory_Copy(element, ptr, meta->Stride); }
+
+	// Fill the gap with the last element, rather than shifting everything after it.
+	const U64 lastIndex = meta->Size - 1;
+	if (index < lastIndex) { Memory_Copy(ptr, (*dynArray) + (lastIndex * meta->Stride), meta->Stride); }
+
 	meta->Size--;
 }
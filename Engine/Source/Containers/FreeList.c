@@ -0,0 +1,38 @@
+#include <Obsidian/Containers/FreeList.h>
+#include <Obsidian/Core/Logger.h>
+
+void FreeList_Initialize(FreeList* list) {
+	list->Head  = NULL;
+	list->Count = 0;
+}
+
+B8 FreeList_IsEmpty(const FreeList* list) {
+	return list->Head == NULL;
+}
+
+U64 FreeList_Count(const FreeList* list) {
+	return list->Count;
+}
+
+void FreeList_Push(FreeList* list, FreeListNode* node) {
+	AssertMsg(node != list->Head, "Free list node was pushed twice in a row!");
+
+	node->Next = list->Head;
+	list->Head = node;
+	list->Count++;
+}
+
+FreeListNode* FreeList_Pop(FreeList* list) {
+	FreeListNode* node = list->Head;
+	if (node == NULL) { return NULL; }
+
+	list->Head = node->Next;
+	list->Count--;
+
+	return node;
+}
+
+void FreeList_PushArray(FreeList* list, void* elements, size_t stride, U64 count, size_t nodeOffset) {
+	// Push from the last element backwards, so that the first element ends up on top.
+	for (U64 i = count; i > 0; --i) { FreeList_Push(list, (FreeListNode*) (elements + ((i - 1) * stride) + nodeOffset)); }
+}
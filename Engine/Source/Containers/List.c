@@ -0,0 +1,105 @@
+#include <Obsidian/Containers/List.h>
+#include <Obsidian/Core/Logger.h>
+
+// Link a node in between two adjacent nodes.
+static void ListLink(ListNode* prev, ListNode* next, ListNode* node) {
+	AssertMsg(!ListNode_IsLinked(node), "List node is already in a list!");
+
+	node->Prev = prev;
+	node->Next = next;
+	prev->Next = node;
+	next->Prev = node;
+}
+
+void List_Initialize(List* list) {
+	list->Head.Next = &list->Head;
+	list->Head.Prev = &list->Head;
+}
+
+void ListNode_Initialize(ListNode* node) {
+	node->Next = NULL;
+	node->Prev = NULL;
+}
+
+B8 ListNode_IsLinked(const ListNode* node) {
+	return node->Next != NULL;
+}
+
+B8 List_IsEmpty(const List* list) {
+	return list->Head.Next == &list->Head;
+}
+
+ListNode* List_Front(const List* list) {
+	return List_IsEmpty(list) ? NULL : list->Head.Next;
+}
+
+ListNode* List_Back(const List* list) {
+	return List_IsEmpty(list) ? NULL : list->Head.Prev;
+}
+
+void List_PushFront(List* list, ListNode* node) {
+	ListLink(&list->Head, list->Head.Next, node);
+}
+
+void List_PushBack(List* list, ListNode* node) {
+	ListLink(list->Head.Prev, &list->Head, node);
+}
+
+void List_InsertBefore(ListNode* position, ListNode* node) {
+	AssertMsg(ListNode_IsLinked(position), "Cannot insert next to a node which is not in a list!");
+	ListLink(position->Prev, position, node);
+}
+
+void List_InsertAfter(ListNode* position, ListNode* node) {
+	AssertMsg(ListNode_IsLinked(position), "Cannot insert next to a node which is not in a list!");
+	ListLink(position, position->Next, node);
+}
+
+void List_Remove(ListNode* node) {
+	AssertMsg(ListNode_IsLinked(node), "Cannot remove a node which is not in a list!");
+
+	node->Prev->Next = node->Next;
+	node->Next->Prev = node->Prev;
+	// Clear the links, so the node can be checked with ListNode_IsLinked() and added to a list again.
+	node->Next = NULL;
+	node->Prev = NULL;
+}
+
+ListNode* List_PopFront(List* list) {
+	ListNode* node = List_Front(list);
+	if (node) { List_Remove(node); }
+
+	return node;
+}
+
+ListNode* List_PopBack(List* list) {
+	ListNode* node = List_Back(list);
+	if (node) { List_Remove(node); }
+
+	return node;
+}
+
+void List_MoveToFront(List* list, ListNode* node) {
+	List_Remove(node);
+	List_PushFront(list, node);
+}
+
+void List_MoveToBack(List* list, ListNode* node) {
+	List_Remove(node);
+	List_PushBack(list, node);
+}
+
+void List_Append(List* dst, List* src) {
+	if (List_IsEmpty(src)) { return; }
+
+	// Stitch the source's elements in between the destination's last element and its head.
+	ListNode* first = src->Head.Next;
+	ListNode* last  = src->Head.Prev;
+	ListNode* tail  = dst->Head.Prev;
+	first->Prev     = tail;
+	last->Next      = &dst->Head;
+	tail->Next      = first;
+	dst->Head.Prev  = last;
+
+	List_Initialize(src);
+}
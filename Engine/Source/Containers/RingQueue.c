@@ -0,0 +1,203 @@
+#include <Obsidian/Containers/RingQueue.h>
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+/**
+ * The producer and consumer each own one index, on its own cache line. Each also keeps a copy of the other's index,
+ * which is only refreshed when the queue looks full or empty, so most operations don't touch the other thread's cache
+ * line at all. Indices only ever grow, and are wrapped into the buffer with a mask.
+ */
+struct SpscQueueT {
+	_Alignas(CACHE_LINE_SIZE) atomic_size_t Head; // Next element to pop, written by the consumer.
+	size_t CachedTail;                            // The consumer's copy of Tail.
+	_Alignas(CACHE_LINE_SIZE) atomic_size_t Tail; // Next element to push, written by the producer.
+	size_t CachedHead;                            // The producer's copy of Head.
+	_Alignas(CACHE_LINE_SIZE) U64 Mask;
+	U64 ElementSize;
+	U8* Elements;
+};
+
+/**
+ * A bounded queue in the style of Dmitry Vyukov's MPMC queue. Every cell has a sequence counter saying which position
+ * it is ready for: a producer may fill it when it equals the position being pushed, and a consumer may empty it when it
+ * is one past the position being popped. Threads claim positions by advancing the enqueue or dequeue index.
+ */
+struct MpmcQueueT {
+	_Alignas(CACHE_LINE_SIZE) atomic_size_t EnqueuePosition;
+	_Alignas(CACHE_LINE_SIZE) atomic_size_t DequeuePosition;
+	_Alignas(CACHE_LINE_SIZE) U64 Mask;
+	U64 ElementSize;
+	U64 CellStride; // Each cell holds its sequence counter followed by the element.
+	U8* Cells;
+};
+
+static U64 RoundUpToPowerOfTwo(U64 value) {
+	U64 result = 1;
+	while (result < value) { result <<= 1; }
+
+	return result;
+}
+
+SpscQueue SpscQueue_Create(U64 elementSize, U64 capacity) {
+	AssertMsg(elementSize > 0 && capacity > 0, "Ring queues must have a size and capacity!");
+	capacity = RoundUpToPowerOfTwo(capacity);
+
+	// The queue's indices must sit on their own cache lines, so the whole block is cache-line aligned.
+	struct SpscQueueT* queue = Memory_AllocateAligned(
+		sizeof(struct SpscQueueT) + (elementSize * capacity), CACHE_LINE_SIZE, MemoryTag_RingQueue);
+	if (queue == NULL) { return NULL; }
+
+	atomic_init(&queue->Head, 0);
+	atomic_init(&queue->Tail, 0);
+	queue->CachedTail  = 0;
+	queue->CachedHead  = 0;
+	queue->Mask        = capacity - 1;
+	queue->ElementSize = elementSize;
+	queue->Elements    = (U8*) (queue + 1);
+
+	return queue;
+}
+
+void SpscQueue_Destroy(SpscQueue queue) {
+	Memory_Free(queue);
+}
+
+B8 SpscQueue_Push(SpscQueue queue, const void* element) {
+	const size_t tail = atomic_load_explicit(&queue->Tail, memory_order_relaxed);
+	if (tail - queue->CachedHead > queue->Mask) {
+		queue->CachedHead = atomic_load_explicit(&queue->Head, memory_order_acquire);
+		if (tail - queue->CachedHead > queue->Mask) { return FALSE; }
+	}
+
+	Memory_Copy(queue->Elements + ((tail & queue->Mask) * queue->ElementSize), element, queue->ElementSize);
+	atomic_store_explicit(&queue->Tail, tail + 1, memory_order_release);
+
+	return TRUE;
+}
+
+B8 SpscQueue_Pop(SpscQueue queue, void* element) {
+	const size_t head = atomic_load_explicit(&queue->Head, memory_order_relaxed);
+	if (head == queue->CachedTail) {
+		queue->CachedTail = atomic_load_explicit(&queue->Tail, memory_order_acquire);
+		if (head == queue->CachedTail) { return FALSE; }
+	}
+
+	Memory_Copy(element, queue->Elements + ((head & queue->Mask) * queue->ElementSize), queue->ElementSize);
+	atomic_store_explicit(&queue->Head, head + 1, memory_order_release);
+
+	return TRUE;
+}
+
+U64 SpscQueue_Size(SpscQueue queue) {
+	const size_t head = atomic_load_explicit(&queue->Head, memory_order_acquire);
+	const size_t tail = atomic_load_explicit(&queue->Tail, memory_order_acquire);
+
+	return tail - head;
+}
+
+U64 SpscQueue_Capacity(SpscQueue queue) {
+	return queue->Mask + 1;
+}
+
+// Get a pointer to a cell's sequence counter. The element is stored right after it.
+static atomic_size_t* MpmcQueue_GetCell(MpmcQueue queue, size_t position) {
+	return (atomic_size_t*) (queue->Cells + ((position & queue->Mask) * queue->CellStride));
+}
+
+MpmcQueue MpmcQueue_Create(U64 elementSize, U64 capacity) {
+	AssertMsg(elementSize > 0 && capacity > 0, "Ring queues must have a size and capacity!");
+	// A single cell can't tell a full queue from an empty one by its sequence counter.
+	capacity = RoundUpToPowerOfTwo(capacity < 2 ? 2 : capacity);
+
+	const U64 cellStride     = (sizeof(atomic_size_t) + elementSize + 7) & ~(U64) 7;
+	struct MpmcQueueT* queue = Memory_AllocateAligned(
+		sizeof(struct MpmcQueueT) + (cellStride * capacity), CACHE_LINE_SIZE, MemoryTag_RingQueue);
+	if (queue == NULL) { return NULL; }
+
+	atomic_init(&queue->EnqueuePosition, 0);
+	atomic_init(&queue->DequeuePosition, 0);
+	queue->Mask        = capacity - 1;
+	queue->ElementSize = elementSize;
+	queue->CellStride  = cellStride;
+	queue->Cells       = (U8*) (queue + 1);
+	for (U64 i = 0; i < capacity; ++i) { atomic_init(MpmcQueue_GetCell(queue, i), i); }
+
+	return queue;
+}
+
+void MpmcQueue_Destroy(MpmcQueue queue) {
+	Memory_Free(queue);
+}
+
+B8 MpmcQueue_Push(MpmcQueue queue, const void* element) {
+	atomic_size_t* cell = NULL;
+	size_t position     = atomic_load_explicit(&queue->EnqueuePosition, memory_order_relaxed);
+	for (;;) {
+		cell                  = MpmcQueue_GetCell(queue, position);
+		const size_t sequence = atomic_load_explicit(cell, memory_order_acquire);
+		const intptr_t diff   = (intptr_t) sequence - (intptr_t) position;
+		if (diff == 0) {
+			// The cell is free, so try to claim this position. On failure, position is updated to the current one.
+			if (atomic_compare_exchange_weak_explicit(
+				&queue->EnqueuePosition, &position, position + 1, memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		} else if (diff < 0) {
+			// The cell still holds the element from one lap ago, so the queue is full.
+			return FALSE;
+		} else {
+			// Another producer claimed this position first.
+			position = atomic_load_explicit(&queue->EnqueuePosition, memory_order_relaxed);
+		}
+	}
+
+	Memory_Copy(cell + 1, element, queue->ElementSize);
+	atomic_store_explicit(cell, position + 1, memory_order_release);
+
+	return TRUE;
+}
+
+B8 MpmcQueue_Pop(MpmcQueue queue, void* element) {
+	atomic_size_t* cell = NULL;
+	size_t position     = atomic_load_explicit(&queue->DequeuePosition, memory_order_relaxed);
+	for (;;) {
+		cell                  = MpmcQueue_GetCell(queue, position);
+		const size_t sequence = atomic_load_explicit(cell, memory_order_acquire);
+		const intptr_t diff   = (intptr_t) sequence - (intptr_t) (position + 1);
+		if (diff == 0) {
+			if (atomic_compare_exchange_weak_explicit(
+				&queue->DequeuePosition, &position, position + 1, memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		} else if (diff < 0) {
+			// The cell hasn't been filled for this position yet, so the queue is empty.
+			return FALSE;
+		} else {
+			// Another consumer claimed this position first.
+			position = atomic_load_explicit(&queue->DequeuePosition, memory_order_relaxed);
+		}
+	}
+
+	Memory_Copy(element, cell + 1, queue->ElementSize);
+	// Mark the cell as free for the producer one lap ahead.
+	atomic_store_explicit(cell, position + queue->Mask + 1, memory_order_release);
+
+	return TRUE;
+}
+
+U64 MpmcQueue_Size(MpmcQueue queue) {
+	const size_t dequeue = atomic_load_explicit(&queue->DequeuePosition, memory_order_acquire);
+	const size_t enqueue = atomic_load_explicit(&queue->EnqueuePosition, memory_order_acquire);
+
+	// The positions are read at different times, so clamp the difference to something sensible.
+	if (enqueue <= dequeue) { return 0; }
+	const U64 size = enqueue - dequeue;
+
+	return size > queue->Mask + 1 ? queue->Mask + 1 : size;
+}
+
+U64 MpmcQueue_Capacity(MpmcQueue queue) {
+	return queue->Mask + 1;
+}
@@ -0,0 +1,224 @@
+#include <Obsidian/Containers/SlotMap.h>
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+
+/**
+ * A slot in the slot map's sparse array. Handles index into the slots, and each slot holding a value points at where
+ * the value lives in the dense array. Slots which don't hold a value form a free list, so slots are reused before new
+ * ones are added.
+ */
+typedef struct SlotMapSlotT {
+	U32 Index;      // For slots holding a value, the value's position in the dense array. Otherwise, the next free slot.
+	U32 Generation; // Incremented every time the slot's value is removed, so that old handles stop matching.
+} SlotMapSlot;
+
+/**
+ * Everything lives in a single allocation: the metadata, the dense values, the slots, and for each value, the slot it
+ * belongs to. There are never more slots than the capacity, as a new slot is only added when every slot holds a value.
+ */
+typedef struct SlotMapMetadataT {
+	U64 Capacity;       // Number of values the slot map has room for.
+	U64 Size;           // Number of values in the slot map.
+	U32 Stride;         // The size of each value.
+	U32 SlotCount;      // Number of slots which have ever held a value.
+	U32 FreeHead;       // First slot of the free list, or SlotMapFree_End if it is empty.
+	U32 Reserved;       // Unused, keeps the values 16-byte aligned.
+	SlotMapSlot* Slots; // The slots, indexed by handle.
+	U32* DenseSlots;    // For each value in the dense array, the slot it belongs to.
+} SlotMapMetadata;
+
+// Marks the end of the free list.
+static const U32 SlotMapFree_End = 0xFFFFFFFF;
+
+// Slot indices are 32 bits, and one value is kept back to mark the end of the free list.
+static const U64 SlotMap_MaxCapacity = 0xFFFFFFFF;
+
+// Get a pointer to the slot map's metadata.
+static SlotMapMetadata* SlotMapGetMetadata(const void* map) {
+	return (SlotMapMetadata*) (map - sizeof(SlotMapMetadata));
+}
+
+// The values are kept 16-byte aligned, the same as any other heap allocation, and the slots follow them.
+static size_t GetSlotsOffset(U64 capacity, U32 stride) {
+	return (capacity * stride + 15) & ~(size_t) 15;
+}
+
+// Allocate a slot map with no values.
+static void* SlotMapAllocate(U64 capacity, U32 stride) {
+	if (capacity > SlotMap_MaxCapacity) {
+		LogE("[SlotMap] Cannot hold %llu values, slot maps can hold at most %llu!", capacity, SlotMap_MaxCapacity);
+		return NULL;
+	}
+
+	const size_t metadataSize = sizeof(SlotMapMetadata);
+	const size_t slotsOffset  = GetSlotsOffset(capacity, stride);
+	const size_t totalSize    = metadataSize + slotsOffset + (capacity * sizeof(SlotMapSlot)) + (capacity * sizeof(U32));
+
+	SlotMapMetadata* meta = Memory_Allocate(totalSize, MemoryTag_SlotMap);
+	if (meta == NULL) { return NULL; }
+
+	void* map        = ((void*) meta) + metadataSize;
+	meta->Capacity   = capacity;
+	meta->Size       = 0;
+	meta->Stride     = stride;
+	meta->SlotCount  = 0;
+	meta->FreeHead   = SlotMapFree_End;
+	meta->Reserved   = 0;
+	meta->Slots      = map + slotsOffset;
+	meta->DenseSlots = (U32*) (meta->Slots + capacity);
+
+	return map;
+}
+
+// Move the slot map into a new allocation with the given capacity, which must be able to hold every slot.
+static B8 SlotMapGrow(SlotMapT map, U64 capacity) {
+	const SlotMapMetadata* meta = SlotMapGetMetadata(*map);
+
+	void* newMap = SlotMapAllocate(capacity, meta->Stride);
+	if (newMap == NULL) { return FALSE; }
+
+	SlotMapMetadata* newMeta = SlotMapGetMetadata(newMap);
+	Memory_Copy(newMap, *map, meta->Size * meta->Stride);
+	Memory_Copy(newMeta->Slots, meta->Slots, meta->SlotCount * sizeof(SlotMapSlot));
+	Memory_Copy(newMeta->DenseSlots, meta->DenseSlots, meta->Size * sizeof(U32));
+	newMeta->Size      = meta->Size;
+	newMeta->SlotCount = meta->SlotCount;
+	newMeta->FreeHead  = meta->FreeHead;
+
+	Memory_Free(SlotMapGetMetadata(*map));
+	*map = newMap;
+
+	return TRUE;
+}
+
+// Invalidate every handle to a slot, and put the slot on the free list.
+static void SlotMapReleaseSlot(SlotMapMetadata* meta, U32 slotIndex) {
+	SlotMapSlot* slot = &meta->Slots[slotIndex];
+	// Generation 0 is kept for null handles, so skip it if the generation ever wraps around.
+	if (++slot->Generation == 0) { slot->Generation = 1; }
+	slot->Index    = meta->FreeHead;
+	meta->FreeHead = slotIndex;
+}
+
+void* _SlotMap_Create(U64 elementSize, U64 capacity) {
+	AssertMsg(elementSize > 0, "Slot maps must have a value size!");
+	AssertMsg(elementSize <= 0xFFFFFFFF, "Slot map value size must fit in 32 bits!");
+
+	return SlotMapAllocate(capacity > 0 ? capacity : 1, elementSize);
+}
+
+void _SlotMap_Destroy(SlotMapT map) {
+	// Pointer to the start of metadata is the same pointer we originally allocated.
+	Memory_Free(SlotMapGetMetadata(*map));
+}
+
+U64 _SlotMap_Size(ConstSlotMapT map) {
+	Assert(map && *map);
+
+	return SlotMapGetMetadata(*map)->Size;
+}
+
+U64 _SlotMap_Capacity(ConstSlotMapT map) {
+	Assert(map && *map);
+
+	return SlotMapGetMetadata(*map)->Capacity;
+}
+
+B8 _SlotMap_Reserve(SlotMapT map, U64 count) {
+	Assert(map && *map);
+
+	if (SlotMapGetMetadata(*map)->Capacity >= count) { return TRUE; }
+
+	return SlotMapGrow(map, count);
+}
+
+SlotMapHandle _SlotMap_Insert(SlotMapT map, const void* value) {
+	Assert(map && *map);
+	SlotMapMetadata* meta = SlotMapGetMetadata(*map);
+
+	// Make room for the new value, doubling our capacity so that many insertions only grow a handful of times.
+	if (meta->Size == meta->Capacity) {
+		U64 newCapacity = meta->Capacity * 2;
+		if (newCapacity > SlotMap_MaxCapacity) { newCapacity = SlotMap_MaxCapacity; }
+		if (newCapacity == meta->Capacity || !SlotMapGrow(map, newCapacity)) { return SlotMap_NullHandle; }
+		meta = SlotMapGetMetadata(*map);
+	}
+
+	// Reuse a free slot if we have one, which already carries the generation for its next value.
+	U32 slotIndex = meta->FreeHead;
+	if (slotIndex != SlotMapFree_End) {
+		meta->FreeHead = meta->Slots[slotIndex].Index;
+	} else {
+		slotIndex                         = meta->SlotCount++;
+		meta->Slots[slotIndex].Generation = 1;
+	}
+
+	// Values are always appended to the dense array.
+	SlotMapSlot* slot            = &meta->Slots[slotIndex];
+	slot->Index                  = meta->Size;
+	meta->DenseSlots[meta->Size] = slotIndex;
+	void* ptr                    = (*map) + (meta->Size * meta->Stride);
+	if (value) {
+		Memory_Copy(ptr, value, meta->Stride);
+	} else {
+		Memory_Zero(ptr, meta->Stride);
+	}
+	meta->Size++;
+
+	return (SlotMapHandle){.Index = slotIndex, .Generation = slot->Generation};
+}
+
+void* _SlotMap_Get(ConstSlotMapT map, SlotMapHandle handle) {
+	Assert(map && *map);
+	const SlotMapMetadata* meta = SlotMapGetMetadata(*map);
+
+	// Free slots have already moved on to their next generation, so a matching generation means the slot holds our
+	// value.
+	if (handle.Index >= meta->SlotCount) { return NULL; }
+	const SlotMapSlot* slot = &meta->Slots[handle.Index];
+	if (slot->Generation != handle.Generation) { return NULL; }
+
+	return (void*) (*map) + (slot->Index * meta->Stride);
+}
+
+B8 _SlotMap_Remove(SlotMapT map, SlotMapHandle handle, void* value) {
+	Assert(map && *map);
+	SlotMapMetadata* meta = SlotMapGetMetadata(*map);
+
+	void* ptr = _SlotMap_Get((ConstSlotMapT) map, handle);
+	if (ptr == NULL) { return FALSE; }
+	if (value) { Memory_Copy(value, ptr, meta->Stride); }
+
+	// Keep the values dense by moving the last value into the gap, and pointing its slot at its new position.
+	const U32 denseIndex = meta->Slots[handle.Index].Index;
+	const U64 lastIndex  = meta->Size - 1;
+	if (denseIndex != lastIndex) {
+		const U32 lastSlot           = meta->DenseSlots[lastIndex];
+		meta->DenseSlots[denseIndex] = lastSlot;
+		meta->Slots[lastSlot].Index  = denseIndex;
+		Memory_Copy(ptr, (*map) + (lastIndex * meta->Stride), meta->Stride);
+	}
+	meta->Size--;
+
+	SlotMapReleaseSlot(meta, handle.Index);
+
+	return TRUE;
+}
+
+SlotMapHandle _SlotMap_HandleAt(ConstSlotMapT map, U64 index) {
+	Assert(map && *map);
+	const SlotMapMetadata* meta = SlotMapGetMetadata(*map);
+
+	AssertMsg(index < meta->Size, "SlotMap index is out of bounds!");
+	const U32 slotIndex = meta->DenseSlots[index];
+
+	return (SlotMapHandle){.Index = slotIndex, .Generation = meta->Slots[slotIndex].Generation};
+}
+
+void _SlotMap_Clear(SlotMapT map) {
+	Assert(map && *map);
+	SlotMapMetadata* meta = SlotMapGetMetadata(*map);
+
+	for (U64 i = 0; i < meta->Size; ++i) { SlotMapReleaseSlot(meta, meta->DenseSlots[i]); }
+	meta->Size = 0;
+}
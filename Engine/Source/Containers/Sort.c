@@ -0,0 +1,460 @@
+#include <Obsidian/Containers/Sort.h>
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+#include <Obsidian/Platform/Platform.h>
+#include <stdatomic.h>
+
+// Number of key bits sorted by each radix pass, and the number of buckets each pass distributes keys between.
+#define SORT_RADIX_BITS    8
+#define SORT_RADIX_BUCKETS (1 << SORT_RADIX_BITS)
+#define SORT_RADIX_MASK    (SORT_RADIX_BUCKETS - 1)
+
+// Arrays up to this size are insertion sorted, as building their histograms would cost more than sorting them.
+#define SORT_INSERTION_MAX 64
+
+// Length of the runs which are insertion sorted before merge sorting begins.
+#define SORT_MERGE_RUN 16
+
+// Fewest keys each thread of a parallel sort is given, below which starting the thread costs more than it saves.
+#define SORT_PARALLEL_MIN_PER_THREAD 65536
+
+// Most threads a parallel sort will use.
+#define SORT_PARALLEL_MAX_THREADS 64
+
+// ===== Radix sort =====
+
+static U64 LoadKey(const void* keys, U64 index, U32 keySize) {
+	return keySize == sizeof(U64) ? ((const U64*) keys)[index] : ((const U32*) keys)[index];
+}
+
+static void StoreKey(void* keys, U64 index, U32 keySize, U64 key) {
+	if (keySize == sizeof(U64)) {
+		((U64*) keys)[index] = key;
+	} else {
+		((U32*) keys)[index] = (U32) key;
+	}
+}
+
+static U32 GetDigitCount(U32 keySize) {
+	return (keySize * 8) / SORT_RADIX_BITS;
+}
+
+// Sort a handful of keys, which is faster than radix sorting them. Keys only move past greater keys, so equal keys keep
+// their order.
+static void InsertionSortKeys(void* keys, U32* values, U64 count, U32 keySize) {
+	for (U64 i = 1; i < count; ++i) {
+		const U64 key   = LoadKey(keys, i, keySize);
+		const U32 value = values ? values[i] : 0;
+		U64 j           = i;
+		for (; j > 0 && LoadKey(keys, j - 1, keySize) > key; --j) {
+			StoreKey(keys, j, keySize, LoadKey(keys, j - 1, keySize));
+			if (values) { values[j] = values[j - 1]; }
+		}
+		StoreKey(keys, j, keySize, key);
+		if (values) { values[j] = value; }
+	}
+}
+
+// Count how many keys fall into each bucket of every digit, reading the keys only once for all of the passes.
+static void BuildHistograms(const void* keys, U64 count, U32 keySize, U64 (*histograms)[SORT_RADIX_BUCKETS]) {
+	if (keySize == sizeof(U64)) {
+		const U64* keys64 = keys;
+		for (U64 i = 0; i < count; ++i) {
+			const U64 key = keys64[i];
+			for (U32 digit = 0; digit < sizeof(U64); ++digit) {
+				histograms[digit][(key >> (digit * SORT_RADIX_BITS)) & SORT_RADIX_MASK]++;
+			}
+		}
+	} else {
+		const U32* keys32 = keys;
+		for (U64 i = 0; i < count; ++i) {
+			const U32 key = keys32[i];
+			for (U32 digit = 0; digit < sizeof(U32); ++digit) {
+				histograms[digit][(key >> (digit * SORT_RADIX_BITS)) & SORT_RADIX_MASK]++;
+			}
+		}
+	}
+}
+
+// Move every key, and its value, to the next position of the bucket its digit falls into.
+static void Scatter(const void* srcKeys,
+                    const U32* srcValues,
+                    void* dstKeys,
+                    U32* dstValues,
+                    U64 count,
+                    U32 keySize,
+                    U32 shift,
+                    U64* offsets) {
+	// Each combination of key size and values gets its own loop, keeping the loops free of anything but the moves.
+	if (keySize == sizeof(U64)) {
+		const U64* src = srcKeys;
+		U64* dst       = dstKeys;
+		if (srcValues) {
+			for (U64 i = 0; i < count; ++i) {
+				const U64 position = offsets[(src[i] >> shift) & SORT_RADIX_MASK]++;
+				dst[position]       = src[i];
+				dstValues[position] = srcValues[i];
+			}
+		} else {
+			for (U64 i = 0; i < count; ++i) { dst[offsets[(src[i] >> shift) & SORT_RADIX_MASK]++] = src[i]; }
+		}
+	} else {
+		const U32* src = srcKeys;
+		U32* dst       = dstKeys;
+		if (srcValues) {
+			for (U64 i = 0; i < count; ++i) {
+				const U64 position = offsets[(src[i] >> shift) & SORT_RADIX_MASK]++;
+				dst[position]       = src[i];
+				dstValues[position] = srcValues[i];
+			}
+		} else {
+			for (U64 i = 0; i < count; ++i) { dst[offsets[(src[i] >> shift) & SORT_RADIX_MASK]++] = src[i]; }
+		}
+	}
+}
+
+/**
+ * Radix sort keys and their values on their lowest digits, moving them back and forth between their own arrays and
+ * the other arrays with each pass. Passes over digits which every key shares are skipped, as they would move nothing.
+ * @return TRUE if the sorted keys ended up in the other arrays, FALSE if they ended up in their own arrays.
+ */
+static B8 RadixSortPasses(
+	void* keys, U32* values, void* otherKeys, U32* otherValues, U64 count, U32 keySize, U32 digitCount) {
+	U64 histograms[sizeof(U64)][SORT_RADIX_BUCKETS];
+	Memory_Zero(histograms, sizeof(histograms));
+	BuildHistograms(keys, count, keySize, histograms);
+
+	const U64 firstKey = LoadKey(keys, 0, keySize);
+	B8 swapped         = FALSE;
+	for (U32 digit = 0; digit < digitCount; ++digit) {
+		const U32 shift = digit * SORT_RADIX_BITS;
+		U64* offsets    = histograms[digit];
+		if (offsets[(firstKey >> shift) & SORT_RADIX_MASK] == count) { continue; }
+
+		// Turn the count of keys in each bucket into the position the bucket's first key will be moved to.
+		U64 position = 0;
+		for (U32 bucket = 0; bucket < SORT_RADIX_BUCKETS; ++bucket) {
+			const U64 bucketCount = offsets[bucket];
+			offsets[bucket]       = position;
+			position += bucketCount;
+		}
+
+		if (swapped) {
+			Scatter(otherKeys, otherValues, keys, values, count, keySize, shift, offsets);
+		} else {
+			Scatter(keys, values, otherKeys, otherValues, count, keySize, shift, offsets);
+		}
+		swapped = !swapped;
+	}
+
+	return swapped;
+}
+
+static B8 RadixSort(void* keys, U32* values, U64 count, U32 keySize, void* scratch) {
+	if (count <= SORT_INSERTION_MAX) {
+		InsertionSortKeys(keys, values, count, keySize);
+		return TRUE;
+	}
+
+	const B8 ownScratch = scratch == NULL;
+	MemoryScratch scope = {0};
+	if (ownScratch) {
+		scope   = Memory_ScratchBegin();
+		scratch = Memory_ScratchAlloc(count * (keySize + sizeof(U32)));
+		if (scratch == NULL) {
+			LogE("[Sort] Failed to allocate scratch memory to sort %llu keys!", count);
+			Memory_ScratchEnd(scope);
+			return FALSE;
+		}
+	}
+
+	void* scratchKeys  = scratch;
+	U32* scratchValues = values ? scratch + (count * keySize) : NULL;
+	if (RadixSortPasses(keys, values, scratchKeys, scratchValues, count, keySize, GetDigitCount(keySize))) {
+		Memory_Copy(keys, scratchKeys, count * keySize);
+		if (values) { Memory_Copy(values, scratchValues, count * sizeof(U32)); }
+	}
+
+	if (ownScratch) { Memory_ScratchEnd(scope); }
+
+	return TRUE;
+}
+
+B8 Sort_RadixU32(U32* keys, U32* values, U64 count, void* scratch) {
+	return RadixSort(keys, values, count, sizeof(U32), scratch);
+}
+
+B8 Sort_RadixU64(U64* keys, U32* values, U64 count, void* scratch) {
+	return RadixSort(keys, values, count, sizeof(U64), scratch);
+}
+
+// ===== Parallel radix sort =====
+
+/**
+ * A parallel sort happens in four steps, each run across every thread. The threads first find which bits of their share
+ * of the keys differ, so that the keys can be split on the highest digit that actually varies, as keys often leave
+ * their top bits unused. They then count how many of their keys fall into each bucket of that digit, move their keys
+ * into those buckets in the scratch buffer, and finally take whole buckets at a time and radix sort them on the lower
+ * digits back into the original arrays.
+ */
+typedef struct SortParallelT {
+	void* Keys;                                 // The keys being sorted.
+	U32* Values;                                // The values being sorted, or NULL.
+	void* ScratchKeys;                          // Where the keys are split into buckets.
+	U32* ScratchValues;                         // Where the values are split into buckets, or NULL.
+	U32 KeySize;                                // The size of each key.
+	U32 Shift;                                  // The shift of the digit the keys are split into buckets by.
+	U64 BucketStart[SORT_RADIX_BUCKETS + 1];    // Position of each bucket once the keys have been split.
+	U32 BucketOrder[SORT_RADIX_BUCKETS];        // The buckets from largest to smallest.
+	_Alignas(CACHE_LINE_SIZE) atomic_uint Next; // Index into BucketOrder of the next bucket to be sorted.
+} SortParallel;
+
+// The work of one thread of a parallel sort.
+typedef struct SortParallelJobT {
+	SortParallel* Sort;              // The sort the job belongs to.
+	U64 Begin;                       // First key of the thread's share.
+	U64 End;                         // One past the last key of the thread's share.
+	U64 Difference;                  // The bits in which any of the thread's keys differ from the first key.
+	U64 Offsets[SORT_RADIX_BUCKETS]; // The number of the thread's keys in each bucket, then where they will be moved.
+} SortParallelJob;
+
+static void SortParallel_FindDifference(void* userData) {
+	SortParallelJob* job     = userData;
+	const SortParallel* sort = job->Sort;
+
+	const U64 firstKey = LoadKey(sort->Keys, 0, sort->KeySize);
+	U64 difference     = 0;
+	for (U64 i = job->Begin; i < job->End; ++i) { difference |= LoadKey(sort->Keys, i, sort->KeySize) ^ firstKey; }
+	job->Difference = difference;
+}
+
+static void SortParallel_Count(void* userData) {
+	SortParallelJob* job     = userData;
+	const SortParallel* sort = job->Sort;
+
+	Memory_Zero(job->Offsets, sizeof(job->Offsets));
+	for (U64 i = job->Begin; i < job->End; ++i) {
+		job->Offsets[(LoadKey(sort->Keys, i, sort->KeySize) >> sort->Shift) & SORT_RADIX_MASK]++;
+	}
+}
+
+static void SortParallel_Split(void* userData) {
+	SortParallelJob* job     = userData;
+	const SortParallel* sort = job->Sort;
+
+	Scatter(sort->Keys + (job->Begin * sort->KeySize),
+	        sort->Values ? sort->Values + job->Begin : NULL,
+	        sort->ScratchKeys,
+	        sort->ScratchValues,
+	        job->End - job->Begin,
+	        sort->KeySize,
+	        sort->Shift,
+	        job->Offsets);
+}
+
+static void SortParallel_SortBuckets(void* userData) {
+	SortParallel* sort = ((SortParallelJob*) userData)->Sort;
+
+	U32 index;
+	while ((index = atomic_fetch_add_explicit(&sort->Next, 1, memory_order_relaxed)) < SORT_RADIX_BUCKETS) {
+		const U32 bucket = sort->BucketOrder[index];
+		const U64 begin  = sort->BucketStart[bucket];
+		const U64 count  = sort->BucketStart[bucket + 1] - begin;
+		// The buckets are ordered by size, so the rest are empty too.
+		if (count == 0) { break; }
+
+		void* bucketKeys  = sort->ScratchKeys + (begin * sort->KeySize);
+		U32* bucketValues = sort->ScratchValues ? sort->ScratchValues + begin : NULL;
+		void* keys        = sort->Keys + (begin * sort->KeySize);
+		U32* values       = sort->Values ? sort->Values + begin : NULL;
+
+		B8 swapped = FALSE;
+		if (count <= SORT_INSERTION_MAX) {
+			InsertionSortKeys(bucketKeys, bucketValues, count, sort->KeySize);
+		} else {
+			const U32 digitCount = sort->Shift / SORT_RADIX_BITS;
+			swapped              = RadixSortPasses(bucketKeys, bucketValues, keys, values, count, sort->KeySize, digitCount);
+		}
+
+		if (!swapped) {
+			Memory_Copy(keys, bucketKeys, count * sort->KeySize);
+			if (values) { Memory_Copy(values, bucketValues, count * sizeof(U32)); }
+		}
+	}
+}
+
+// Run a step of a parallel sort on every job, with the calling thread taking the first job itself.
+static void SortParallel_Run(PlatformThreadFn fn, SortParallelJob* jobs, U32 jobCount) {
+	PlatformThread threads[SORT_PARALLEL_MAX_THREADS];
+	for (U32 i = 1; i < jobCount; ++i) {
+		threads[i] = Platform_ThreadCreate(fn, &jobs[i]);
+		// Should a thread fail to start, its job is done here instead.
+		if (threads[i] == NULL) { fn(&jobs[i]); }
+	}
+	fn(&jobs[0]);
+	for (U32 i = 1; i < jobCount; ++i) {
+		if (threads[i]) { Platform_ThreadJoin(threads[i]); }
+	}
+}
+
+static B8 RadixSortParallel(void* keys, U32* values, U64 count, U32 keySize, U32 threadCount, void* scratch) {
+	if (threadCount == 0) { threadCount = Platform_GetProcessorCount(); }
+	if (threadCount > count / SORT_PARALLEL_MIN_PER_THREAD) { threadCount = count / SORT_PARALLEL_MIN_PER_THREAD; }
+	if (threadCount > SORT_PARALLEL_MAX_THREADS) { threadCount = SORT_PARALLEL_MAX_THREADS; }
+	if (threadCount <= 1) { return RadixSort(keys, values, count, keySize, scratch); }
+
+	// Other threads can't use our scratch allocator, so the jobs, and the scratch buffer if we weren't given one, are
+	// allocated from the heap.
+	const size_t jobsSize    = threadCount * sizeof(SortParallelJob);
+	const size_t scratchSize = scratch ? 0 : count * (keySize + sizeof(U32));
+	void* memory             = Memory_Allocate(jobsSize + scratchSize, MemoryTag_Job);
+	if (memory == NULL) {
+		LogE("[Sort] Failed to allocate memory to sort %llu keys across %u threads!", count, threadCount);
+		return FALSE;
+	}
+	SortParallelJob* jobs = memory;
+	if (scratch == NULL) { scratch = memory + jobsSize; }
+
+	SortParallel sort;
+	sort.Keys          = keys;
+	sort.Values        = values;
+	sort.ScratchKeys   = scratch;
+	sort.ScratchValues = values ? scratch + (count * keySize) : NULL;
+	sort.KeySize       = keySize;
+	sort.Shift         = 0;
+	atomic_init(&sort.Next, 0);
+
+	// Give each thread an equal share of the keys.
+	for (U32 i = 0; i < threadCount; ++i) {
+		jobs[i].Sort  = &sort;
+		jobs[i].Begin = (count * i) / threadCount;
+		jobs[i].End   = (count * (i + 1)) / threadCount;
+	}
+
+	// Find the highest digit in which the keys differ. If they are all equal, they are already sorted.
+	SortParallel_Run(SortParallel_FindDifference, jobs, threadCount);
+	U64 difference = 0;
+	for (U32 i = 0; i < threadCount; ++i) { difference |= jobs[i].Difference; }
+	if (difference == 0) {
+		Memory_Free(memory);
+		return TRUE;
+	}
+	while ((difference >> sort.Shift) > SORT_RADIX_MASK) { sort.Shift += SORT_RADIX_BITS; }
+
+	// Split the keys into buckets by that digit. Within each bucket, every thread's keys are placed after those of the
+	// threads before it, so the split keeps equal keys in their order.
+	SortParallel_Run(SortParallel_Count, jobs, threadCount);
+	U64 position = 0;
+	for (U32 bucket = 0; bucket < SORT_RADIX_BUCKETS; ++bucket) {
+		sort.BucketStart[bucket] = position;
+		for (U32 i = 0; i < threadCount; ++i) {
+			const U64 bucketCount   = jobs[i].Offsets[bucket];
+			jobs[i].Offsets[bucket] = position;
+			position += bucketCount;
+		}
+	}
+	sort.BucketStart[SORT_RADIX_BUCKETS] = count;
+	SortParallel_Run(SortParallel_Split, jobs, threadCount);
+
+	// Sort the largest buckets first, so that no thread is left sorting a large bucket after the others have finished.
+	for (U32 i = 0; i < SORT_RADIX_BUCKETS; ++i) {
+		const U32 bucket = i;
+		const U64 size   = sort.BucketStart[bucket + 1] - sort.BucketStart[bucket];
+		U32 j            = i;
+		for (; j > 0; --j) {
+			const U32 other = sort.BucketOrder[j - 1];
+			if (sort.BucketStart[other + 1] - sort.BucketStart[other] >= size) { break; }
+			sort.BucketOrder[j] = other;
+		}
+		sort.BucketOrder[j] = bucket;
+	}
+	SortParallel_Run(SortParallel_SortBuckets, jobs, threadCount);
+
+	Memory_Free(memory);
+
+	return TRUE;
+}
+
+B8 Sort_RadixParallelU32(U32* keys, U32* values, U64 count, U32 threadCount, void* scratch) {
+	return RadixSortParallel(keys, values, count, sizeof(U32), threadCount, scratch);
+}
+
+B8 Sort_RadixParallelU64(U64* keys, U32* values, U64 count, U32 threadCount, void* scratch) {
+	return RadixSortParallel(keys, values, count, sizeof(U64), threadCount, scratch);
+}
+
+// ===== Comparison sort =====
+
+// Insertion sort a run of elements, using temp to hold the element being moved.
+static void InsertionSortElements(void* elements, U64 count, U64 stride, SortCompareFn compare, void* temp) {
+	for (U64 i = 1; i < count; ++i) {
+		void* element = elements + (i * stride);
+		U64 j         = i;
+		while (j > 0 && compare(elements + ((j - 1) * stride), element) > 0) { --j; }
+		if (j == i) { continue; }
+
+		Memory_Copy(temp, element, stride);
+		Memory_Move(elements + ((j + 1) * stride), elements + (j * stride), (i - j) * stride);
+		Memory_Copy(elements + (j * stride), temp, stride);
+	}
+}
+
+// Merge two adjacent sorted runs of src into dst. Equal elements are taken from the left run first, keeping the sort
+// stable.
+static void Merge(const void* src, void* dst, U64 begin, U64 middle, U64 end, U64 stride, SortCompareFn compare) {
+	U64 left  = begin;
+	U64 right = middle;
+	U64 out   = begin;
+	while (left < middle && right < end) {
+		if (compare(src + (right * stride), src + (left * stride)) < 0) {
+			Memory_Copy(dst + (out++ * stride), src + (right++ * stride), stride);
+		} else {
+			Memory_Copy(dst + (out++ * stride), src + (left++ * stride), stride);
+		}
+	}
+
+	// Whatever is left of either run is already in order.
+	Memory_Copy(dst + (out * stride), src + (left * stride), (middle - left) * stride);
+	out += middle - left;
+	Memory_Copy(dst + (out * stride), src + (right * stride), (end - right) * stride);
+}
+
+B8 Sort_Stable(void* elements, U64 count, U64 stride, SortCompareFn compare, void* scratch) {
+	if (count < 2) { return TRUE; }
+
+	const B8 ownScratch = scratch == NULL;
+	MemoryScratch scope = {0};
+	if (ownScratch) {
+		scope   = Memory_ScratchBegin();
+		scratch = Memory_ScratchAlloc(count * stride);
+		if (scratch == NULL) {
+			LogE("[Sort] Failed to allocate scratch memory to sort %llu elements!", count);
+			Memory_ScratchEnd(scope);
+			return FALSE;
+		}
+	}
+
+	// Sort short runs in place, then merge them back and forth with the scratch buffer, doubling in length each time.
+	for (U64 begin = 0; begin < count; begin += SORT_MERGE_RUN) {
+		const U64 runLength = count - begin < SORT_MERGE_RUN ? count - begin : SORT_MERGE_RUN;
+		InsertionSortElements(elements + (begin * stride), runLength, stride, compare, scratch);
+	}
+
+	void* src = elements;
+	void* dst = scratch;
+	for (U64 width = SORT_MERGE_RUN; width < count; width *= 2) {
+		for (U64 begin = 0; begin < count; begin += 2 * width) {
+			const U64 middle = begin + width < count ? begin + width : count;
+			const U64 end    = begin + (2 * width) < count ? begin + (2 * width) : count;
+			Merge(src, dst, begin, middle, end, stride, compare);
+		}
+		void* temp = src;
+		src        = dst;
+		dst        = temp;
+	}
+	if (src != elements) { Memory_Copy(elements, src, count * stride); }
+
+	if (ownScratch) { Memory_ScratchEnd(scope); }
+
+	return TRUE;
+}
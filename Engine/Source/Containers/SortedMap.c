@@ -0,0 +1,274 @@
+#include <Obsidian/Containers/SortedMap.h>
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#	include <intrin.h>
+#	if defined(_M_ARM64)
+#		define SortedMapPrefetch(ptr) __prefetch(ptr)
+#	else
+#		define SortedMapPrefetch(ptr) _mm_prefetch((const char*) (ptr), _MM_HINT_T0)
+#	endif
+#else
+#	define SortedMapPrefetch(ptr) __builtin_prefetch(ptr)
+#endif
+
+/**
+ * Everything lives in a single allocation: the metadata, the values, and the keys. Entries are kept sorted by key, with
+ * the keys in their own array so that searching only pulls keys into the cache, eight to a cache line.
+ */
+typedef struct SortedMapMetadataT {
+	U64 Capacity;  // Number of entries the map has room for.
+	U64 Size;      // Number of entries in the map.
+	U32 ValueSize; // The size of each value.
+	U32 Reserved;  // Unused, keeps the values 16-byte aligned.
+	U64* Keys;     // The keys, in ascending order.
+} SortedMapMetadata;
+
+// Get a pointer to the map's metadata.
+static SortedMapMetadata* SortedMapGetMetadata(const void* map) {
+	return (SortedMapMetadata*) (map - sizeof(SortedMapMetadata));
+}
+
+// The values are kept 16-byte aligned, the same as any other heap allocation, and the keys follow them.
+static size_t GetKeysOffset(U64 capacity, U32 valueSize) {
+	return (capacity * valueSize + 15) & ~(size_t) 15;
+}
+
+// Allocate a map with no entries.
+static void* SortedMapAllocate(U64 capacity, U32 valueSize) {
+	const size_t metadataSize = sizeof(SortedMapMetadata);
+	const size_t keysOffset   = GetKeysOffset(capacity, valueSize);
+	const size_t totalSize    = metadataSize + keysOffset + (capacity * sizeof(U64));
+
+	SortedMapMetadata* meta = Memory_Allocate(totalSize, MemoryTag_BinarySearchTree);
+	if (meta == NULL) { return NULL; }
+
+	void* map       = ((void*) meta) + metadataSize;
+	meta->Capacity  = capacity;
+	meta->Size      = 0;
+	meta->ValueSize = valueSize;
+	meta->Reserved  = 0;
+	meta->Keys      = map + keysOffset;
+
+	return map;
+}
+
+// Move the map into a new allocation with the given capacity, which must be able to hold every entry.
+static B8 SortedMapGrow(SortedMapT map, U64 capacity) {
+	const SortedMapMetadata* meta = SortedMapGetMetadata(*map);
+
+	void* newMap = SortedMapAllocate(capacity, meta->ValueSize);
+	if (newMap == NULL) { return FALSE; }
+
+	SortedMapMetadata* newMeta = SortedMapGetMetadata(newMap);
+	Memory_Copy(newMap, *map, meta->Size * meta->ValueSize);
+	Memory_Copy(newMeta->Keys, meta->Keys, meta->Size * sizeof(U64));
+	newMeta->Size = meta->Size;
+
+	Memory_Free(SortedMapGetMetadata(*map));
+	*map = newMap;
+
+	return TRUE;
+}
+
+/**
+ * Find the first key which is not less than the given key. The search halves the range without branching on the
+ * comparison, which compiles to a conditional move and so never mispredicts. Without a branch to speculate past, each
+ * load would wait on the one before it, so both keys the next step might compare against are prefetched instead.
+ */
+static U64 LowerBound(const U64* keys, U64 size, U64 key) {
+	if (size == 0) { return 0; }
+
+	U64 base = 0;
+	while (size > 1) {
+		const U64 half = size / 2;
+		SortedMapPrefetch(&keys[base + half / 2]);
+		SortedMapPrefetch(&keys[base + half + half / 2]);
+		base = keys[base + half] < key ? base + half : base;
+		size -= half;
+	}
+
+	return base + (keys[base] < key);
+}
+
+void* _SortedMap_Create(U64 valueSize, U64 capacity) {
+	AssertMsg(valueSize > 0, "Sorted maps must have a value size!");
+	AssertMsg(valueSize <= 0xFFFFFFFF, "Sorted map value size must fit in 32 bits!");
+
+	return SortedMapAllocate(capacity > 0 ? capacity : 1, valueSize);
+}
+
+void _SortedMap_Destroy(SortedMapT map) {
+	// Pointer to the start of metadata is the same pointer we originally allocated.
+	Memory_Free(SortedMapGetMetadata(*map));
+}
+
+U64 _SortedMap_Size(ConstSortedMapT map) {
+	Assert(map && *map);
+
+	return SortedMapGetMetadata(*map)->Size;
+}
+
+U64 _SortedMap_Capacity(ConstSortedMapT map) {
+	Assert(map && *map);
+
+	return SortedMapGetMetadata(*map)->Capacity;
+}
+
+B8 _SortedMap_Reserve(SortedMapT map, U64 count) {
+	Assert(map && *map);
+
+	if (SortedMapGetMetadata(*map)->Capacity >= count) { return TRUE; }
+
+	return SortedMapGrow(map, count);
+}
+
+B8 _SortedMap_Build(SortedMapT map, const U64* keys, const void* values, U64 count) {
+	Assert(map && *map);
+
+	for (U64 i = 1; i < count; ++i) {
+		if (keys[i - 1] >= keys[i]) {
+			LogE("[SortedMap] Cannot build from unsorted keys, key %llu is not greater than key %llu!", i, i - 1);
+			return FALSE;
+		}
+	}
+
+	if (!_SortedMap_Reserve(map, count)) { return FALSE; }
+
+	SortedMapMetadata* meta = SortedMapGetMetadata(*map);
+	Memory_Copy(meta->Keys, keys, count * sizeof(U64));
+	if (values) {
+		Memory_Copy(*map, values, count * meta->ValueSize);
+	} else {
+		Memory_Zero(*map, count * meta->ValueSize);
+	}
+	meta->Size = count;
+
+	return TRUE;
+}
+
+void* _SortedMap_Insert(SortedMapT map, U64 key, const void* value) {
+	Assert(map && *map);
+	SortedMapMetadata* meta = SortedMapGetMetadata(*map);
+
+	U64 index = LowerBound(meta->Keys, meta->Size, key);
+	void* ptr = (*map) + (index * meta->ValueSize);
+
+	// Replace the value of an existing entry.
+	if (index < meta->Size && meta->Keys[index] == key) {
+		if (value) { Memory_Copy(ptr, value, meta->ValueSize); }
+		return ptr;
+	}
+
+	// Make room for the new entry, doubling our capacity so that many insertions only grow a handful of times.
+	if (meta->Size == meta->Capacity) {
+		if (!SortedMapGrow(map, meta->Capacity * 2)) { return NULL; }
+		meta = SortedMapGetMetadata(*map);
+		ptr  = (*map) + (index * meta->ValueSize);
+	}
+
+	// Shift every later entry along by one.
+	const U64 after = meta->Size - index;
+	if (after > 0) {
+		Memory_Move(ptr + meta->ValueSize, ptr, after * meta->ValueSize);
+		Memory_Move(&meta->Keys[index + 1], &meta->Keys[index], after * sizeof(U64));
+	}
+	meta->Keys[index] = key;
+	if (value) {
+		Memory_Copy(ptr, value, meta->ValueSize);
+	} else {
+		Memory_Zero(ptr, meta->ValueSize);
+	}
+	meta->Size++;
+
+	return ptr;
+}
+
+void* _SortedMap_Find(ConstSortedMapT map, U64 key) {
+	Assert(map && *map);
+	const SortedMapMetadata* meta = SortedMapGetMetadata(*map);
+
+	const U64 index = LowerBound(meta->Keys, meta->Size, key);
+	if (index == meta->Size || meta->Keys[index] != key) { return NULL; }
+
+	return (void*) (*map) + (index * meta->ValueSize);
+}
+
+B8 _SortedMap_Remove(SortedMapT map, U64 key, void* value) {
+	Assert(map && *map);
+	SortedMapMetadata* meta = SortedMapGetMetadata(*map);
+
+	const U64 index = LowerBound(meta->Keys, meta->Size, key);
+	if (index == meta->Size || meta->Keys[index] != key) { return FALSE; }
+
+	void* ptr = (*map) + (index * meta->ValueSize);
+	if (value) { Memory_Copy(value, ptr, meta->ValueSize); }
+
+	// Shift every later entry back by one.
+	const U64 after = meta->Size - index - 1;
+	if (after > 0) {
+		Memory_Move(ptr, ptr + meta->ValueSize, after * meta->ValueSize);
+		Memory_Move(&meta->Keys[index], &meta->Keys[index + 1], after * sizeof(U64));
+	}
+	meta->Size--;
+
+	return TRUE;
+}
+
+void _SortedMap_Clear(SortedMapT map) {
+	Assert(map && *map);
+
+	SortedMapGetMetadata(*map)->Size = 0;
+}
+
+U64 _SortedMap_LowerBound(ConstSortedMapT map, U64 key) {
+	Assert(map && *map);
+	const SortedMapMetadata* meta = SortedMapGetMetadata(*map);
+
+	return LowerBound(meta->Keys, meta->Size, key);
+}
+
+U64 _SortedMap_UpperBound(ConstSortedMapT map, U64 key) {
+	Assert(map && *map);
+	const SortedMapMetadata* meta = SortedMapGetMetadata(*map);
+
+	// The first key greater than the given key is the first key not less than the next one.
+	if (key == (U64) -1) { return meta->Size; }
+
+	return LowerBound(meta->Keys, meta->Size, key + 1);
+}
+
+U64 _SortedMap_Range(ConstSortedMapT map, U64 minKey, U64 maxKey, U64* first) {
+	Assert(map && *map);
+	Assert(first);
+
+	*first = _SortedMap_LowerBound(map, minKey);
+	if (minKey > maxKey) { return 0; }
+
+	return _SortedMap_UpperBound(map, maxKey) - *first;
+}
+
+U64 _SortedMap_KeyAt(ConstSortedMapT map, U64 index) {
+	Assert(map && *map);
+	const SortedMapMetadata* meta = SortedMapGetMetadata(*map);
+
+	AssertMsg(index < meta->Size, "SortedMap index is out of bounds!");
+
+	return meta->Keys[index];
+}
+
+const U64* _SortedMap_Keys(ConstSortedMapT map) {
+	Assert(map && *map);
+
+	return SortedMapGetMetadata(*map)->Keys;
+}
+
+U64 SortedMap_KeyFromF64(F64 value) {
+	U64 bits;
+	Memory_Copy(&bits, &value, sizeof(bits));
+
+	// Positive numbers already sort in order once their sign bit is set, and negative numbers sort in reverse, so
+	// flipping every bit puts them in order below the positive numbers.
+	return (bits & ((U64) 1 << 63)) ? ~bits : bits | ((U64) 1 << 63);
+}
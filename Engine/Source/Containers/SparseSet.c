@@ -0,0 +1,135 @@
+#include <Obsidian/Containers/SparseSet.h>
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+
+/**
+ * The members are kept in the dense array, which the user's pointer points at, and the sparse array maps each value
+ * to its position in the dense array. A value is only a member if the two agree, so the sparse array never needs
+ * cleaning up when members are removed.
+ */
+typedef struct SparseSetMetadataT {
+	U64 Capacity;       // Number of members the dense array has room for.
+	U64 Size;           // Number of members in the set.
+	U64 SparseCapacity; // Number of entries in the sparse array, one more than the largest value it can hold.
+	U32* Sparse;        // For each value, its position in the dense array if it is a member.
+} SparseSetMetadata;
+
+// Get a pointer to the set's metadata.
+static SparseSetMetadata* SparseSetGetMetadata(const void* set) {
+	return (SparseSetMetadata*) (set - sizeof(SparseSetMetadata));
+}
+
+// Grow the sparse array so that it can hold the given value. New entries are zeroed, which is harmless as entries are
+// checked against the dense array anyway, but keeps them from being uninitialized.
+static B8 SparseSetGrowSparse(SparseSetMetadata* meta, U32 value) {
+	U64 newCapacity = meta->SparseCapacity * 2;
+	if (newCapacity < (U64) value + 1) { newCapacity = (U64) value + 1; }
+	if (newCapacity > (U64) 0xFFFFFFFF + 1) { newCapacity = (U64) 0xFFFFFFFF + 1; }
+
+	U32* sparse = Memory_Reallocate(meta->Sparse, newCapacity * sizeof(U32));
+	if (sparse == NULL) { return FALSE; }
+
+	Memory_Zero(sparse + meta->SparseCapacity, (newCapacity - meta->SparseCapacity) * sizeof(U32));
+	meta->Sparse         = sparse;
+	meta->SparseCapacity = newCapacity;
+
+	return TRUE;
+}
+
+U32* _SparseSet_Create(U64 capacity, U32 maxValue) {
+	if (capacity == 0) { capacity = 1; }
+
+	const size_t metadataSize = sizeof(SparseSetMetadata);
+	SparseSetMetadata* meta   = Memory_Allocate(metadataSize + (capacity * sizeof(U32)), MemoryTag_SparseSet);
+	if (meta == NULL) { return NULL; }
+
+	const U64 sparseCapacity = (U64) maxValue + 1;
+	meta->Sparse             = Memory_Allocate(sparseCapacity * sizeof(U32), MemoryTag_SparseSet);
+	if (meta->Sparse == NULL) {
+		Memory_Free(meta);
+		return NULL;
+	}
+	Memory_Zero(meta->Sparse, sparseCapacity * sizeof(U32));
+	meta->Capacity       = capacity;
+	meta->Size           = 0;
+	meta->SparseCapacity = sparseCapacity;
+
+	return ((void*) meta) + metadataSize;
+}
+
+void _SparseSet_Destroy(SparseSetT set) {
+	SparseSetMetadata* meta = SparseSetGetMetadata(*set);
+	Memory_Free(meta->Sparse);
+	// Pointer to the start of metadata is the same pointer we originally allocated.
+	Memory_Free(meta);
+}
+
+U64 _SparseSet_Size(ConstSparseSetT set) {
+	Assert(set && *set);
+
+	return SparseSetGetMetadata(*set)->Size;
+}
+
+B8 _SparseSet_Add(SparseSetT set, U32 value) {
+	Assert(set && *set);
+	SparseSetMetadata* meta = SparseSetGetMetadata(*set);
+
+	if (_SparseSet_Contains((ConstSparseSetT) set, value)) { return TRUE; }
+
+	if (value >= meta->SparseCapacity && !SparseSetGrowSparse(meta, value)) { return FALSE; }
+
+	// Double the dense array when it is full, so that many additions only grow it a handful of times.
+	if (meta->Size == meta->Capacity) {
+		const U64 newCapacity      = meta->Capacity * 2;
+		const size_t metadataSize  = sizeof(SparseSetMetadata);
+		SparseSetMetadata* newMeta = Memory_Reallocate(meta, metadataSize + (newCapacity * sizeof(U32)));
+		if (newMeta == NULL) { return FALSE; }
+		newMeta->Capacity = newCapacity;
+		meta              = newMeta;
+		*set              = ((void*) newMeta) + metadataSize;
+	}
+
+	(*set)[meta->Size]  = value;
+	meta->Sparse[value] = meta->Size;
+	meta->Size++;
+
+	return TRUE;
+}
+
+B8 _SparseSet_Remove(SparseSetT set, U32 value) {
+	Assert(set && *set);
+	SparseSetMetadata* meta = SparseSetGetMetadata(*set);
+
+	if (!_SparseSet_Contains((ConstSparseSetT) set, value)) { return FALSE; }
+
+	// Move the last member into the gap, keeping the members dense.
+	const U32 index    = meta->Sparse[value];
+	const U32 last     = (*set)[meta->Size - 1];
+	(*set)[index]      = last;
+	meta->Sparse[last] = index;
+	meta->Size--;
+
+	return TRUE;
+}
+
+B8 _SparseSet_Contains(ConstSparseSetT set, U32 value) {
+	return _SparseSet_IndexOf(set, value) < SparseSetGetMetadata(*set)->Size;
+}
+
+U64 _SparseSet_IndexOf(ConstSparseSetT set, U32 value) {
+	Assert(set && *set);
+	const SparseSetMetadata* meta = SparseSetGetMetadata(*set);
+
+	if (value >= meta->SparseCapacity) { return meta->Size; }
+	const U32 index = meta->Sparse[value];
+	if (index >= meta->Size || (*set)[index] != value) { return meta->Size; }
+
+	return index;
+}
+
+void _SparseSet_Clear(SparseSetT set) {
+	Assert(set && *set);
+
+	// The sparse entries of old members no longer agree with the dense array, so they don't need clearing.
+	SparseSetGetMetadata(*set)->Size = 0;
+}
@@ -3,6 +3,8 @@
 #include <Obsidian/Core/Event.h>
 #include <Obsidian/Core/Input.h>
 #include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+#include <Obsidian/Core/StringId.h>
 #include <Obsidian/Platform/Platform.h>
 #include <Obsidian/Renderer/Renderer.h>
 
@@ -10,9 +12,13 @@ struct ApplicationT {
 	PlatformState Platform;
 	ApplicationCallbacks Callbacks;
 	B8 Running;
+	B8 ShutDown;
 	Clock MainClock;
 	F64 LastUpdate;
 	void* UserData;
+	U64 FrameLimit;
+	B8 Uncapped;
+	ApplicationFrameStats FrameStats;
 };
 
 B8 Application_Create(const ApplicationCreateInfo* createInfo, Application* app) {
@@ -30,22 +36,39 @@ B8 Application_Create(const ApplicationCreateInfo* createInfo, Application* app)
 	}
 
 	// Copy data into our new application object.
-	(*app)->Callbacks = createInfo->Callbacks;
-	(*app)->UserData  = createInfo->UserData;
+	(*app)->Callbacks  = createInfo->Callbacks;
+	(*app)->UserData   = createInfo->UserData;
+	(*app)->FrameLimit = createInfo->FrameLimit;
+	(*app)->Uncapped   = createInfo->Uncapped;
 
 	// Initialize the system platform.
-	if (!Platform_Initialize(&(*app)->Platform,
-	                         createInfo->Name,
-	                         createInfo->WindowX,
-	                         createInfo->WindowY,
-	                         createInfo->WindowW,
-	                         createInfo->WindowH)) {
+	B8 platformInitialized = FALSE;
+	if (createInfo->Headless) {
+		platformInitialized =
+			Platform_InitializeHeadless(&(*app)->Platform, createInfo->Name, createInfo->WindowW, createInfo->WindowH);
+	} else {
+		platformInitialized = Platform_Initialize(&(*app)->Platform,
+		                                          createInfo->Name,
+		                                          createInfo->WindowX,
+		                                          createInfo->WindowY,
+		                                          createInfo->WindowW,
+		                                          createInfo->WindowH);
+	}
+	if (!platformInitialized) {
 		LogF("[Application] Failed to initialize Platform layer!");
 		Application_Shutdown(*app);
 
 		return FALSE;
 	}
 
+	// Initialize the string ID system.
+	if (!StringId_Initialize()) {
+		LogF("[Application] Failed to initialize StringId system!");
+		Application_Shutdown(*app);
+
+		return FALSE;
+	}
+
 	// Initialize the event system.
 	if (!Event_Initialize()) {
 		LogF("[Application] Failed to initialize Event system!");
@@ -62,8 +85,13 @@ B8 Application_Create(const ApplicationCreateInfo* createInfo, Application* app)
 		return FALSE;
 	}
 
-	// Initialize the rendering system.
-	if (!Renderer_Initialize(createInfo->Name, (*app)->Platform)) {
+	// Initialize the rendering system. A headless platform has no window to present to, so Vulkan renders offscreen.
+	RenderEngineType renderEngine = createInfo->RenderEngine;
+	if (renderEngine == RenderEngineType_Vulkan && Platform_IsHeadless((*app)->Platform)) {
+		LogD("[Application] Platform is headless, using the headless Vulkan render engine.");
+		renderEngine = RenderEngineType_VulkanHeadless;
+	}
+	if (!Renderer_Initialize(createInfo->Name, renderEngine, (*app)->Platform)) {
 		LogF("[Application] Failed to initialize Rendering system!");
 		Application_Shutdown(*app);
 
@@ -84,6 +112,25 @@ B8 Application_Create(const ApplicationCreateInfo* createInfo, Application* app)
 	return TRUE;
 }
 
+static void UpdateFrameStats(ApplicationFrameStats* stats, F64 frameTime) {
+	if (stats->FrameCount == 0 || frameTime < stats->MinFrameTime) { stats->MinFrameTime = frameTime; }
+	if (frameTime > stats->MaxFrameTime) { stats->MaxFrameTime = frameTime; }
+	stats->TotalFrameTime += frameTime;
+	stats->FrameCount++;
+}
+
+static void LogFrameStats(const ApplicationFrameStats* stats) {
+	if (stats->FrameCount == 0) { return; }
+
+	const F64 avgFrameTime = stats->TotalFrameTime / (F64) stats->FrameCount;
+	LogI("[Application] Ran %llu frames. Frame time avg %.3f ms, min %.3f ms, max %.3f ms (%.1f FPS uncapped).",
+	     stats->FrameCount,
+	     avgFrameTime * 1000.0,
+	     stats->MinFrameTime * 1000.0,
+	     stats->MaxFrameTime * 1000.0,
+	     1.0 / avgFrameTime);
+}
+
 B8 Application_Run(Application app) {
 	AssertMsg(!app->Running, "Application is already running!");
 
@@ -92,9 +139,7 @@ B8 Application_Run(Application app) {
 	Clock_Start(&app->MainClock);
 	Clock_Update(&app->MainClock);
 	app->LastUpdate = app->MainClock.Elapsed;
-
-	F64 runtime   = 0.0;
-	U8 frameCount = 0;
+	Memory_Zero(&app->FrameStats, sizeof(ApplicationFrameStats));
 
 	B8 badShutdown = FALSE;
 	app->Running   = TRUE;
@@ -125,32 +170,46 @@ B8 Application_Run(Application app) {
 
 		Input_Update(deltaTime);
 
+		Memory_FrameReset();
+
 		const F64 frameEndTime = Platform_GetAbsoluteTime();
 		const F64 frameTime    = frameEndTime - frameStartTime;
-		runtime += frameTime;
-		const F64 spareTime = targetFps - frameTime;
-		if (spareTime > 0.0) {
-			const U64 spareMs = spareTime * 1000;
-			if (spareMs > 1) { Platform_Sleep(spareMs - 1); }
-			frameCount++;
+		UpdateFrameStats(&app->FrameStats, frameTime);
+		if (!app->Uncapped) {
+			const F64 spareTime = targetFps - frameTime;
+			if (spareTime > 0.0) {
+				const U64 spareMs = spareTime * 1000;
+				if (spareMs > 1) { Platform_Sleep(spareMs - 1); }
+			}
 		}
 
 		app->LastUpdate = now;
+
+		if (app->FrameLimit > 0 && app->FrameStats.FrameCount >= app->FrameLimit) { app->Running = FALSE; }
 	}
+	LogFrameStats(&app->FrameStats);
 	Application_Shutdown(app);
 
 	return badShutdown == FALSE;
 }
 
 void Application_Shutdown(Application app) {
+	// Application_Run() and Application_Create() shut down on exit, so we may be called a second time from the entry
+	// point. Only the first call tears anything down.
 	if (app) {
-		app->Running = FALSE;
+		if (app->ShutDown) { return; }
+		app->ShutDown = TRUE;
+		app->Running  = FALSE;
 		if (app->Callbacks.Shutdown) { app->Callbacks.Shutdown(app); }
 	}
 	Renderer_Shutdown();
 	Input_Shutdown();
 	Event_Shutdown();
-	Platform_Shutdown(app->Platform);
+	StringId_Shutdown();
+	if (app && app->Platform) {
+		Platform_Shutdown(app->Platform);
+		app->Platform = NULL;
+	}
 }
 
 void Application_RequestShutdown(Application app) {
@@ -158,6 +217,10 @@ void Application_RequestShutdown(Application app) {
 	if (Event_Fire(EventCode_ApplicationQuit, NULL, evt) == FALSE) { app->Running = FALSE; }
 }
 
+void Application_GetFrameStats(Application app, ApplicationFrameStats* stats) {
+	*stats = app->FrameStats;
+}
+
 void Application_SetUserData(Application app, void* ptr) {
 	app->UserData = ptr;
 }
@@ -36,6 +36,7 @@ void Event_Shutdown() {
 
 B8 Event_Register(U16 code, void* listener, EventHandlerFn handler) {
 	if (EventSystem.Codes[code].Listeners == NULL) { EventSystem.Codes[code].Listeners = DynArray_Create(EventListener); }
+	if (EventSystem.Codes[code].Listeners == NULL) { return FALSE; }
 
 	EventListener* listeners = EventSystem.Codes[code].Listeners;
 
@@ -45,10 +46,9 @@ B8 Event_Register(U16 code, void* listener, EventHandlerFn handler) {
 		if (listeners[i].Listener == listener) { return FALSE; }
 	}
 
+	// Push through the stored pointer, as the array may move when it grows.
 	EventListener newListener = {.Listener = listener, .Handler = handler};
-	DynArray_Push(&listeners, newListener);
-
-	return TRUE;
+	return DynArray_Push(&EventSystem.Codes[code].Listeners, newListener);
 }
 
 B8 Event_Unregister(U16 code, void* listener, EventHandlerFn handler) {
@@ -61,7 +61,9 @@ B8 Event_Unregister(U16 code, void* listener, EventHandlerFn handler) {
 
 	for (U64 i = 0; i < listenerCount; ++i) {
 		if (listeners[i].Listener == listener && listeners[i].Handler == handler) {
-			DynArray_Extract(&listeners, i, NULL);
+			// Listeners are called in the order they registered, and may stop the event from propagating, so the order must
+			// be preserved rather than using DynArray_SwapRemove().
+			DynArray_Extract(&EventSystem.Codes[code].Listeners, i, NULL);
 			return TRUE;
 		}
 	}
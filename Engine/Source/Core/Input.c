@@ -2,8 +2,12 @@
 #include <Obsidian/Core/Input.h>
 #include <Obsidian/Core/Memory.h>
 
+// Number of key codes, see Key.
+#define INPUT_KEY_COUNT 256
+
+// One bit per key, so the whole keyboard fits in 32 bytes.
 typedef struct KeyboardStateT {
-	B8 Keys[256];
+	U64 Keys[INPUT_KEY_COUNT / 64];
 } KeyboardState;
 
 typedef struct MouseStateT {
@@ -21,6 +25,10 @@ typedef struct InputStateT {
 
 static InputState Input = {};
 
+static B8 KeyboardState_Test(const KeyboardState* state, Key key) {
+	return (state->Keys[key / 64] >> (key % 64)) & 1;
+}
+
 B8 Input_Initialize() {
 	Memory_Zero(&Input, sizeof(InputState));
 
@@ -58,8 +66,8 @@ void Input_ProcessScroll(I8 zDelta) {
 }
 
 void Input_ProcessKey(Key key, B8 press) {
-	if (Input.Keyboard.Keys[key] != press) {
-		Input.Keyboard.Keys[key] = press;
+	if (KeyboardState_Test(&Input.Keyboard, key) != (press != FALSE)) {
+		Input.Keyboard.Keys[key / 64] ^= (U64) 1 << (key % 64);
 
 		EventContext onKey = {};
 		onKey.Data.U16[0]  = key;
@@ -73,19 +81,19 @@ void Input_Update(F64 deltaTime) {
 }
 
 B8 Input_IsKeyDown(Key key) {
-	return Input.Keyboard.Keys[key];
+	return KeyboardState_Test(&Input.Keyboard, key);
 }
 
 B8 Input_IsKeyUp(Key key) {
-	return Input.Keyboard.Keys[key] == FALSE;
+	return KeyboardState_Test(&Input.Keyboard, key) == FALSE;
 }
 
 B8 Input_WasKeyDown(Key key) {
-	return Input.LastKeyboard.Keys[key];
+	return KeyboardState_Test(&Input.LastKeyboard, key);
 }
 
 B8 Input_WasKeyUp(Key key) {
-	return Input.LastKeyboard.Keys[key] == FALSE;
+	return KeyboardState_Test(&Input.LastKeyboard, key) == FALSE;
 }
 
 void Input_GetMousePosition(I32* x, I32* y) {
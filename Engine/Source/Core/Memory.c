@@ -1,15 +1,25 @@
 #include <Obsidian/Core/Logger.h>
 #include <Obsidian/Core/Memory.h>
+#include <Obsidian/Core/MemoryGuard.h>
+#include <Obsidian/Core/MemoryPool.h>
+#include <Obsidian/Core/MemoryTracking.h>
+#include <Obsidian/Core/VirtualArena.h>
 #include <Obsidian/Platform/Platform.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 
 static const char* MemoryTagNames[MemoryTag_End] = {"Unknown",
                                                     "Internal",
                                                     "Array",
                                                     "BinarySearchTree",
+                                                    "Bitset",
                                                     "Dictionary",
                                                     "DynamicArray",
                                                     "RingQueue",
+                                                    "SlotMap",
+                                                    "SparseSet",
                                                     "String",
                                                     "Application",
                                                     "Game",
@@ -22,31 +32,505 @@ static const char* MemoryTagNames[MemoryTag_End] = {"Unknown",
                                                     "EntityNode",
                                                     "Transform"};
 
+/**
+ * Metadata placed immediately before every allocation. The alignment is stored as a power-of-two exponent so that the
+ * header stays at 16 bytes however large the alignment is, and is the only overhead for allocations which need no more
+ * alignment than the platform heap already guarantees.
+ */
 struct AllocationT {
 	U64 Size;
-	U32 Alignment;
-	U32 Tag;
+	U16 Tag;
+	U8 Flags;
+	U8 AlignmentShift;
+	U32 Allocator; // Index of the custom allocator the block came from, or 0 for the built-in heap.
 };
 
+/** Alignment which every block from Platform_Alloc() already has, so no aligned allocation is needed. */
+#define MEMORY_NATURAL_ALIGNMENT _Alignof(max_align_t)
+/** Internal allocation flag, set when a block belongs to one of the small-object size classes. */
+#define ALLOCATION_FLAG_CACHED (1 << 7)
+
+/** Largest allocation served from the small-object caches. */
+#define MEMORY_SIZE_CLASS_MAX 1024
+/** Smallest allocation assumed to be served from whole pages by the platform heap, see Memory_GetGoodSize(). */
+#define MEMORY_PAGE_ROUNDING_MIN (128 * 1024)
+/** Number of small-object size classes, see GetSizeClass(). */
+#define MEMORY_SIZE_CLASS_COUNT 20
+/** Number of blocks moved between a thread cache and the global depot at once. */
+#define MEMORY_CACHE_BATCH_SIZE 32
+/** Number of blocks a thread cache keeps for each size class before returning a batch to the depot. */
+#define MEMORY_CACHE_BIN_LIMIT (MEMORY_CACHE_BATCH_SIZE * 2)
+/** Number of batches the depot keeps for each size class before returning memory to the platform. */
+#define MEMORY_DEPOT_BATCH_LIMIT 16
+
+/**
+ * Allocation statistics written by a single thread. Only the owning thread writes to its shard, so updates need no
+ * atomic read-modify-write, and shards are cache-line aligned so threads never write to the same cache line.
+ * Memory freed on a different thread than it was allocated on will make a shard's counters wrap around, but the sum
+ * across all shards is always exact. The shared shard is the exception, written by every thread which could not
+ * allocate its own, so its updates are atomic. Shards are never freed before shutdown, as their counters are still part
+ * of the totals, so a thread which exits hands its shard over to the next thread which needs one.
+ */
+struct MemoryStatShardT {
+	_Alignas(CACHE_LINE_SIZE) atomic_size_t TotalAllocations;
+	atomic_size_t TotalAllocatedBytes;
+	atomic_size_t AllocationsByTag[MemoryTag_End];
+	atomic_size_t AllocatedBytesByTag[MemoryTag_End];
+	atomic_size_t CachedBytes;
+	// Running totals which only ever grow, used to measure the heap activity of each frame.
+	atomic_size_t AllocationsMadeByTag[MemoryTag_End];
+	atomic_size_t FreesMadeByTag[MemoryTag_End];
+	atomic_size_t BytesAllocatedByTag[MemoryTag_End];
+	atomic_size_t BytesFreedByTag[MemoryTag_End];
+	B8 Shared;
+	atomic_flag InUse; // Set while a thread owns the shard.
+	struct MemoryStatShardT* Next;
+};
+
+// The thread which initializes the memory subsystem uses the static shard, all others allocate their own on first use.
+static struct MemoryStatShardT MainStatShard;
+static struct MemoryStatShardT SharedStatShard;
+static _Atomic(struct MemoryStatShardT*) MemoryStatShards;
+static THREAD_LOCAL struct MemoryStatShardT* LocalStatShard;
+
+// Statistics for the frame arenas, which may only be used from the main thread.
 struct MemoryStatsT {
-	size_t TotalAllocations;
-	size_t TotalAllocatedBytes;
+	// These only cover allocations which are still live, across both frame arenas.
+	size_t FrameAllocatedBytes;
+	size_t FramePeakBytes;
+	size_t FrameAllocationsByTag[MemoryTag_End];
+	size_t FrameAllocatedBytesByTag[MemoryTag_End];
+};
+static struct MemoryStatsT MemoryStats;
+
+// Heap activity of recent frames, recorded by Memory_FrameReset() on the main thread.
+static struct {
+	MemoryFrameRecord Records[MEMORY_FRAME_HISTORY_LENGTH];
+	U64 FrameCount;             // Number of frames recorded so far.
+	MemoryFrameRecord Baseline; // Running totals across all threads at the end of the previous frame.
+} FrameHistory;
+
+/**
+ * Freed small blocks of a single size class, linked through their first word. Blocks keep their allocation header, so
+ * they can be handed straight back out.
+ */
+struct MemoryCacheBinT {
+	void* Head;
+	U32 Count;
+};
+
+/**
+ * Small-object cache owned by a single thread, so allocating and freeing small blocks needs no locking. Other threads
+ * may be walking the list of caches, so they are never freed before shutdown. Memory_ThreadShutdown() empties the
+ * cache of a thread which exits instead, and hands it over to the next thread which needs one.
+ */
+struct MemoryThreadCacheT {
+	struct MemoryCacheBinT Bins[MEMORY_SIZE_CLASS_COUNT];
+	atomic_flag InUse; // Set while a thread owns the cache.
+	struct MemoryThreadCacheT* Next;
+};
+static _Atomic(struct MemoryThreadCacheT*) MemoryThreadCaches;
+static THREAD_LOCAL struct MemoryThreadCacheT* LocalThreadCache;
+
+/**
+ * Global depot of full batches of freed blocks, shared between all threads. Threads only touch the depot once every
+ * MEMORY_CACHE_BATCH_SIZE allocations or frees. Batches are linked through the second word of their first block.
+ */
+static struct {
+	atomic_flag Lock;
+	void* Batches;
+	U32 Count;
+} MemoryDepot[MEMORY_SIZE_CLASS_COUNT];
+
+/** Maximum number of different custom allocators which can be registered. */
+#define MEMORY_MAX_ALLOCATORS 32
+
+// Custom allocators are copied into slots which are never reused, so blocks can always find theirs. Slot 0 stands
+// for the built-in heap.
+static MemoryAllocator Allocators[MEMORY_MAX_ALLOCATORS];
+static U32 AllocatorCount;
+static _Atomic(U32) TagAllocators[MemoryTag_End];
+// Allocator used by tags which haven't been given one, which is the guard page allocator when it is enabled.
+static U32 DefaultAllocator;
+
+/** Address space reserved for each thread's scratch allocator. Memory is only committed as it is used. */
+#define MEMORY_SCRATCH_RESERVE_SIZE (64 * 1024 * 1024)
+/** Alignment used for scratch allocations which do not request one. */
+#define MEMORY_SCRATCH_DEFAULT_ALIGNMENT 16
+
+/**
+ * A thread's scratch allocator. It lives at the start of its own arena, so that threads which exit without warning
+ * don't leave dangling entries in the list of scratch allocators. Memory_ThreadShutdown() returns the arena's pages
+ * and hands it over to the next thread which needs one.
+ */
+struct MemoryScratchStateT {
+	VirtualArena Arena;
+	U32 Depth;         // Number of scratch scopes currently open.
+	atomic_flag InUse; // Set while a thread owns the allocator.
+	struct MemoryScratchStateT* Next;
+};
+static _Atomic(struct MemoryScratchStateT*) MemoryScratchStates;
+static THREAD_LOCAL struct MemoryScratchStateT* LocalScratchState;
+
+/** A region of memory which has asked to be backed by huge pages. */
+struct HugeRegionT {
+	void* Ptr;
+	size_t Bytes;
+	MemoryTag Tag;
+	B8 Explicit;
+};
+
+// Huge regions are few and large, so a simple locked array is enough to keep track of them.
+static struct {
+	atomic_flag Lock;
+	struct HugeRegionT* Regions;
+	U32 Count;
+	U32 Capacity;
+} HugeRegions = {.Lock = ATOMIC_FLAG_INIT};
+
+/** Capacity of the first block in a frame arena. Arenas grow past this as needed. */
+#define FRAME_ARENA_BLOCK_SIZE (1024 * 1024)
+/** Alignment used for frame allocations which do not request one. */
+#define FRAME_ARENA_DEFAULT_ALIGNMENT 16
+
+struct FrameBlockT {
+	struct FrameBlockT* Next;
+	size_t Capacity;
+	size_t Used;
+};
+
+struct FrameArenaT {
+	struct FrameBlockT* Blocks; // The head block is the one currently being allocated from.
+	size_t Capacity;
+	size_t AllocatedBytes;
 	size_t AllocationsByTag[MemoryTag_End];
 	size_t AllocatedBytesByTag[MemoryTag_End];
 };
-static struct MemoryStatsT MemoryStats;
+
+// Frame allocations are double-buffered, so that data may be kept alive for one extra frame.
+static struct FrameArenaT FrameArenas[2];
+static U32 FrameArenaIndex;
+
+static struct MemoryStatShardT* GetStatShard() {
+	struct MemoryStatShardT* shard = LocalStatShard;
+	if (shard) { return shard; }
+
+	// Take over the shard of a thread which has exited, if there is one.
+	shard = atomic_load_explicit(&MemoryStatShards, memory_order_acquire);
+	while (shard && atomic_flag_test_and_set_explicit(&shard->InUse, memory_order_acquire)) { shard = shard->Next; }
+	if (shard) {
+		LocalStatShard = shard;
+		return shard;
+	}
+
+	shard = Platform_AllocAligned(sizeof(struct MemoryStatShardT), CACHE_LINE_SIZE);
+	if (shard == NULL) {
+		// Fall back to the shared shard, which is slower to update but keeps our statistics exact.
+		LogE("[Memory] Failed to allocate memory statistics for thread, falling back to shared statistics!");
+		LocalStatShard = &SharedStatShard;
+		return &SharedStatShard;
+	}
+	Memory_Zero(shard, sizeof(struct MemoryStatShardT));
+	atomic_flag_test_and_set_explicit(&shard->InUse, memory_order_relaxed);
+
+	struct MemoryStatShardT* head = atomic_load_explicit(&MemoryStatShards, memory_order_relaxed);
+	do {
+		shard->Next = head;
+	} while (!atomic_compare_exchange_weak_explicit(
+		&MemoryStatShards, &head, shard, memory_order_release, memory_order_relaxed));
+
+	LocalStatShard = shard;
+
+	return shard;
+}
+
+static void StatAdd(struct MemoryStatShardT* shard, atomic_size_t* counter, size_t value) {
+	if (shard->Shared) {
+		atomic_fetch_add_explicit(counter, value, memory_order_relaxed);
+	} else {
+		atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + value, memory_order_relaxed);
+	}
+}
+
+static void StatSub(struct MemoryStatShardT* shard, atomic_size_t* counter, size_t value) {
+	if (shard->Shared) {
+		atomic_fetch_sub_explicit(counter, value, memory_order_relaxed);
+	} else {
+		atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) - value, memory_order_relaxed);
+	}
+}
+
+/** Count a heap allocation towards the current frame's activity. */
+static void StatRecordAllocation(struct MemoryStatShardT* stats, MemoryTag tag, size_t bytes) {
+	StatAdd(stats, &stats->AllocationsMadeByTag[tag], 1);
+	StatAdd(stats, &stats->BytesAllocatedByTag[tag], bytes);
+}
+
+/** Count a heap free towards the current frame's activity. */
+static void StatRecordFree(struct MemoryStatShardT* stats, MemoryTag tag, size_t bytes) {
+	StatAdd(stats, &stats->FreesMadeByTag[tag], 1);
+	StatAdd(stats, &stats->BytesFreedByTag[tag], bytes);
+}
 
 /** Determine how many bytes we need to add to the allocation to fit our metadata, while keeping the requested
  * alignment. */
-static size_t GetTrackingOverhead(U8 align) {
+static size_t GetTrackingOverhead(size_t align) {
 	return (align < sizeof(struct AllocationT)) ? sizeof(struct AllocationT) : align;
 }
 
+/** Get the alignment an allocation was made with. */
+static size_t GetAlignment(const struct AllocationT* tracking) {
+	return (size_t) 1 << tracking->AlignmentShift;
+}
+
+/** Get the exponent of a power-of-two alignment. */
+static U8 GetAlignmentShift(size_t align) {
+	U8 shift = 0;
+	while (((size_t) 1 << shift) < align) { ++shift; }
+
+	return shift;
+}
+
+/** Determine whether an allocation with the given alignment needs to come from Platform_AllocAligned(). */
+static B8 NeedsAlignedAllocation(size_t align) {
+	return align > MEMORY_NATURAL_ALIGNMENT;
+}
+
+/**
+ * Get the size class an allocation of up to MEMORY_SIZE_CLASS_MAX bytes belongs to. Classes are 16 bytes apart up to
+ * 128 bytes, and above that every power-of-two range is split into four classes, bounding the waste to 25%.
+ */
+static U32 GetSizeClass(size_t size) {
+	if (size <= 128) { return (U32) ((size + 15) / 16) - 1; }
+
+	U32 rangeShift = 7;
+	while (((size_t) 2 << rangeShift) < size) { ++rangeShift; }
+	const size_t step = (size_t) 1 << (rangeShift - 2);
+
+	return 8 + (rangeShift - 7) * 4 + (U32) ((size - ((size_t) 1 << rangeShift) + step - 1) / step) - 1;
+}
+
+/** Get the number of usable bytes in each block of a size class. */
+static size_t GetSizeClassSize(U32 sizeClass) {
+	if (sizeClass < 8) { return (sizeClass + 1) * 16; }
+
+	const U32 rangeShift = 7 + (sizeClass - 8) / 4;
+
+	return ((size_t) 1 << rangeShift) + ((sizeClass - 8) % 4 + 1) * ((size_t) 1 << (rangeShift - 2));
+}
+
+/** Determine how many bytes were actually requested from the platform for an allocation. */
+static size_t GetBlockSize(const struct AllocationT* tracking) {
+	if (tracking->Flags & ALLOCATION_FLAG_CACHED) {
+		return GetSizeClassSize(GetSizeClass(tracking->Size)) + sizeof(struct AllocationT);
+	}
+
+	const size_t actualSize = tracking->Size + GetTrackingOverhead(GetAlignment(tracking));
+	if (tracking->Flags & MemoryFlag_HugePages) {
+		const size_t hugePageSize = Platform_GetHugePageSize();
+		return (actualSize + hugePageSize - 1) & ~(hugePageSize - 1);
+	}
+
+	return actualSize;
+}
+
 /** Get the allocation metadata from the user-visible pointer. */
 static struct AllocationT* GetAllocationMetadata(void* ptr) {
 	return (struct AllocationT*) (ptr - sizeof(struct AllocationT));
 }
 
+static struct MemoryThreadCacheT* GetThreadCache() {
+	struct MemoryThreadCacheT* cache = LocalThreadCache;
+	if (cache) { return cache; }
+
+	// Take over the cache of a thread which has exited, if there is one.
+	cache = atomic_load_explicit(&MemoryThreadCaches, memory_order_acquire);
+	while (cache && atomic_flag_test_and_set_explicit(&cache->InUse, memory_order_acquire)) { cache = cache->Next; }
+	if (cache) {
+		LocalThreadCache = cache;
+		return cache;
+	}
+
+	cache = Platform_Alloc(sizeof(struct MemoryThreadCacheT));
+	if (cache == NULL) {
+		// Small allocations on this thread will go straight to the platform instead.
+		return NULL;
+	}
+	Memory_Zero(cache, sizeof(struct MemoryThreadCacheT));
+	atomic_flag_test_and_set_explicit(&cache->InUse, memory_order_relaxed);
+
+	struct MemoryThreadCacheT* head = atomic_load_explicit(&MemoryThreadCaches, memory_order_relaxed);
+	do {
+		cache->Next = head;
+	} while (!atomic_compare_exchange_weak_explicit(
+		&MemoryThreadCaches, &head, cache, memory_order_release, memory_order_relaxed));
+
+	LocalThreadCache = cache;
+
+	return cache;
+}
+
+/** Return a chain of cached blocks to the platform. */
+static void FreeCachedBlocks(void* block, U32 sizeClass) {
+	const size_t blockSize         = GetSizeClassSize(sizeClass) + sizeof(struct AllocationT);
+	struct MemoryStatShardT* stats = GetStatShard();
+	while (block) {
+		void* next = *(void**) block;
+		StatSub(stats, &stats->CachedBytes, blockSize);
+		Platform_Free(block - sizeof(struct AllocationT));
+		block = next;
+	}
+}
+
+/** Give a batch of MEMORY_CACHE_BATCH_SIZE blocks to the depot, or return it to the platform if the depot is full. */
+static void Depot_Push(void* batch, U32 sizeClass) {
+	while (atomic_flag_test_and_set_explicit(&MemoryDepot[sizeClass].Lock, memory_order_acquire)) {}
+	const B8 depotFull = MemoryDepot[sizeClass].Count >= MEMORY_DEPOT_BATCH_LIMIT;
+	if (!depotFull) {
+		((void**) batch)[1]            = MemoryDepot[sizeClass].Batches;
+		MemoryDepot[sizeClass].Batches = batch;
+		MemoryDepot[sizeClass].Count++;
+	}
+	atomic_flag_clear_explicit(&MemoryDepot[sizeClass].Lock, memory_order_release);
+
+	if (depotFull) { FreeCachedBlocks(batch, sizeClass); }
+}
+
+/** Split a batch of MEMORY_CACHE_BATCH_SIZE blocks off the front of a bin, which must hold at least that many. */
+static void* CacheBin_PopBatch(struct MemoryCacheBinT* bin) {
+	void* batch = bin->Head;
+	void* last  = batch;
+	for (U32 i = 1; i < MEMORY_CACHE_BATCH_SIZE; ++i) { last = *(void**) last; }
+	bin->Head      = *(void**) last;
+	*(void**) last = NULL;
+	bin->Count -= MEMORY_CACHE_BATCH_SIZE;
+
+	return batch;
+}
+
+/** Take a freed block of the given size class from this thread's cache, refilling it from the depot if needed. */
+static void* ThreadCache_Pop(U32 sizeClass) {
+	struct MemoryThreadCacheT* cache = GetThreadCache();
+	if (cache == NULL) { return NULL; }
+
+	struct MemoryCacheBinT* bin = &cache->Bins[sizeClass];
+	if (bin->Head == NULL) {
+		while (atomic_flag_test_and_set_explicit(&MemoryDepot[sizeClass].Lock, memory_order_acquire)) {}
+		void* batch = MemoryDepot[sizeClass].Batches;
+		if (batch) {
+			MemoryDepot[sizeClass].Batches = ((void**) batch)[1];
+			MemoryDepot[sizeClass].Count--;
+		}
+		atomic_flag_clear_explicit(&MemoryDepot[sizeClass].Lock, memory_order_release);
+
+		if (batch == NULL) { return NULL; }
+		bin->Head  = batch;
+		bin->Count = MEMORY_CACHE_BATCH_SIZE;
+	}
+
+	void* block = bin->Head;
+	bin->Head   = *(void**) block;
+	bin->Count--;
+	struct MemoryStatShardT* stats = GetStatShard();
+	StatSub(stats, &stats->CachedBytes, GetSizeClassSize(sizeClass) + sizeof(struct AllocationT));
+
+	return block;
+}
+
+/** Give a freed block to this thread's cache, moving a batch to the depot once the cache is full. */
+static void ThreadCache_Push(void* block, U32 sizeClass) {
+	struct MemoryStatShardT* stats = GetStatShard();
+	StatAdd(stats, &stats->CachedBytes, GetSizeClassSize(sizeClass) + sizeof(struct AllocationT));
+
+	struct MemoryThreadCacheT* cache = GetThreadCache();
+	if (cache == NULL) {
+		*(void**) block = NULL;
+		FreeCachedBlocks(block, sizeClass);
+		return;
+	}
+
+	struct MemoryCacheBinT* bin = &cache->Bins[sizeClass];
+	*(void**) block             = bin->Head;
+	bin->Head                   = block;
+	bin->Count++;
+	if (bin->Count < MEMORY_CACHE_BIN_LIMIT) { return; }
+
+	Depot_Push(CacheBin_PopBatch(bin), sizeClass);
+}
+
+static uintptr_t AlignUp(uintptr_t value, size_t align) {
+	return (value + align - 1) & ~((uintptr_t) align - 1);
+}
+
+/** Attempt to bump-allocate from a single frame block. */
+static void* FrameBlock_Allocate(struct FrameBlockT* block, size_t size, size_t align) {
+	if (block == NULL) { return NULL; }
+
+	const uintptr_t base  = (uintptr_t) (block + 1);
+	const uintptr_t start = AlignUp(base + block->Used, align);
+	if (start + size > base + block->Capacity) { return NULL; }
+
+	block->Used = (start + size) - base;
+
+	return (void*) start;
+}
+
+static struct FrameBlockT* FrameArena_AddBlock(struct FrameArenaT* arena, size_t capacity) {
+	struct FrameBlockT* block = Memory_Allocate(sizeof(struct FrameBlockT) + capacity, MemoryTag_Internal);
+	if (block == NULL) { return NULL; }
+
+	block->Next     = arena->Blocks;
+	block->Capacity = capacity;
+	block->Used     = 0;
+	arena->Blocks   = block;
+	arena->Capacity += capacity;
+
+	return block;
+}
+
+/** Remove all of the arena's allocations from the frame statistics. */
+static void FrameArena_ClearStats(struct FrameArenaT* arena) {
+	for (U32 tag = 0; tag < MemoryTag_End; ++tag) {
+		MemoryStats.FrameAllocationsByTag[tag] -= arena->AllocationsByTag[tag];
+		MemoryStats.FrameAllocatedBytesByTag[tag] -= arena->AllocatedBytesByTag[tag];
+	}
+	MemoryStats.FrameAllocatedBytes -= arena->AllocatedBytes;
+
+	arena->AllocatedBytes = 0;
+	Memory_Zero(arena->AllocationsByTag, sizeof(arena->AllocationsByTag));
+	Memory_Zero(arena->AllocatedBytesByTag, sizeof(arena->AllocatedBytesByTag));
+}
+
+static void FrameArena_Release(struct FrameArenaT* arena) {
+	struct FrameBlockT* block = arena->Blocks;
+	while (block) {
+		struct FrameBlockT* next = block->Next;
+		Memory_Free(block);
+		block = next;
+	}
+	arena->Blocks   = NULL;
+	arena->Capacity = 0;
+}
+
+static void FrameArena_Reset(struct FrameArenaT* arena) {
+	FrameArena_ClearStats(arena);
+	if (arena->Blocks == NULL) { return; }
+
+	if (arena->Blocks->Next) {
+		// The arena had to grow during the frame. Replace its blocks with a single block large enough to hold
+		// everything, so the next frame can be served without growing again.
+		const size_t capacity = arena->Capacity;
+		FrameArena_Release(arena);
+		FrameArena_AddBlock(arena, capacity);
+	} else {
+#if OBSIDIAN_DEBUG == 1
+		// Poison the released memory, to help catch frame allocations being used for too long.
+		Memory_Set(arena->Blocks + 1, 0xCD, arena->Blocks->Used);
+#endif
+		arena->Blocks->Used = 0;
+	}
+}
+
 static void FormatMemoryUsage(char* buffer, size_t bufferSize, size_t bytes) {
 	const U64 gib = 1024 * 1024 * 1024;
 	const U64 mib = 1024 * 1024;
@@ -63,44 +547,266 @@ static void FormatMemoryUsage(char* buffer, size_t bufferSize, size_t bytes) {
 	}
 }
 
+#if OBSIDIAN_DEBUG == 1
+/**
+ * Perform sanity checks against double-frees. Freeing memory twice drives the totals below zero, wrapping them around.
+ * Other threads may be allocating while the shards are summed, so these checks can only catch gross errors.
+ */
+static void CheckForDoubleFrees(const MemoryUsage* usage) {
+	if ((I64) usage->TotalAllocations < 0) {
+		LogE("[Memory] Possible double-free: %lld more allocations have been freed than were made!",
+		     -(I64) usage->TotalAllocations);
+	}
+	if ((I64) usage->TotalAllocatedBytes < 0) {
+		LogE("[Memory] Possible double-free: %lld more bytes have been freed than were allocated!",
+		     -(I64) usage->TotalAllocatedBytes);
+	}
+	for (U32 tag = 0; tag < MemoryTag_End; ++tag) {
+		if ((I64) usage->AllocatedBytesByTag[tag] < 0) {
+			LogE("[Memory] Possible double-free: %lld more '%s' bytes have been freed than were allocated!",
+			     -(I64) usage->AllocatedBytesByTag[tag],
+			     MemoryTagNames[tag]);
+		}
+	}
+}
+#endif
+
 B8 Memory_Initialize() {
+	Memory_Zero(&MainStatShard, sizeof(MainStatShard));
+	Memory_Zero(&SharedStatShard, sizeof(SharedStatShard));
+	SharedStatShard.Shared = TRUE;
+	MainStatShard.Next     = &SharedStatShard;
+	// The static shards are never handed over to another thread.
+	atomic_flag_test_and_set(&MainStatShard.InUse);
+	atomic_flag_test_and_set(&SharedStatShard.InUse);
+	atomic_store(&MemoryStatShards, &MainStatShard);
+	LocalStatShard = &MainStatShard;
+
 	Memory_Zero(&MemoryStats, sizeof(MemoryStats));
+	Memory_Zero(&FrameHistory, sizeof(FrameHistory));
+	Memory_Zero(Allocators, sizeof(Allocators));
+	AllocatorCount   = 1;
+	DefaultAllocator = 0;
+#if OBSIDIAN_MEMORY_GUARD == 1
+	MemoryGuard_Initialize();
+	Allocators[AllocatorCount] = *MemoryGuard_GetAllocator();
+	DefaultAllocator           = AllocatorCount++;
+#endif
+	for (U32 tag = 0; tag < MemoryTag_End; ++tag) { atomic_store(&TagAllocators[tag], DefaultAllocator); }
+	Memory_Zero(FrameArenas, sizeof(FrameArenas));
+	FrameArenaIndex = 0;
+
+#if OBSIDIAN_MEMORY_TRACKING == 1
+	MemoryTracking_Initialize();
+#endif
 
 	return TRUE;
 }
 
 void Memory_Shutdown() {
+	for (U32 i = 0; i < 2; ++i) {
+		FrameArena_ClearStats(&FrameArenas[i]);
+		FrameArena_Release(&FrameArenas[i]);
+	}
+
+#if OBSIDIAN_MEMORY_TRACKING == 1
+	// List every leaked block along with where it was allocated.
+	MemoryTracking_Shutdown();
+#endif
+
 #if OBSIDIAN_DEBUG == 1
 	// Memory leak check
-	if (MemoryStats.TotalAllocatedBytes != 0) {
-		LogW("[Memory] %lld bytes are still allocated at program termination!", MemoryStats.TotalAllocatedBytes);
+	MemoryUsage usage;
+	Memory_GetUsage(&usage);
+	if (usage.TotalAllocatedBytes != 0) {
+		// A double-free leaves the total below zero, which Memory_LogUsage() reports.
+		if ((I64) usage.TotalAllocatedBytes > 0) {
+			LogW("[Memory] %lld bytes are still allocated at program termination!", usage.TotalAllocatedBytes);
+		}
 		Memory_LogUsage();
 	}
 #endif
+
+	// Return every cached block to the platform. No thread may allocate after this point.
+	struct MemoryThreadCacheT* cache = atomic_exchange(&MemoryThreadCaches, NULL);
+	while (cache) {
+		struct MemoryThreadCacheT* next = cache->Next;
+		for (U32 sizeClass = 0; sizeClass < MEMORY_SIZE_CLASS_COUNT; ++sizeClass) {
+			FreeCachedBlocks(cache->Bins[sizeClass].Head, sizeClass);
+		}
+		Platform_Free(cache);
+		cache = next;
+	}
+	LocalThreadCache = NULL;
+	for (U32 sizeClass = 0; sizeClass < MEMORY_SIZE_CLASS_COUNT; ++sizeClass) {
+		void* batch = MemoryDepot[sizeClass].Batches;
+		while (batch) {
+			void* next = ((void**) batch)[1];
+			FreeCachedBlocks(batch, sizeClass);
+			batch = next;
+		}
+		MemoryDepot[sizeClass].Batches = NULL;
+		MemoryDepot[sizeClass].Count   = 0;
+	}
+
+#if OBSIDIAN_MEMORY_GUARD == 1
+	MemoryGuard_Shutdown();
+#endif
+
+	// Release every thread's scratch allocator.
+	struct MemoryScratchStateT* scratch = atomic_exchange(&MemoryScratchStates, NULL);
+	while (scratch) {
+		struct MemoryScratchStateT* next = scratch->Next;
+		VirtualArena arena               = scratch->Arena;
+		VirtualArena_Destroy(&arena);
+		scratch = next;
+	}
+	LocalScratchState = NULL;
+
+	// Release the statistics of every other thread.
+	struct MemoryStatShardT* shard = atomic_exchange(&MemoryStatShards, NULL);
+	while (shard) {
+		struct MemoryStatShardT* next = shard->Next;
+		if (shard != &MainStatShard && shard != &SharedStatShard) { Platform_FreeAligned(shard); }
+		shard = next;
+	}
+	LocalStatShard = NULL;
 }
 
-void* Memory_Allocate(size_t size, MemoryTag tag) {
+void Memory_ThreadShutdown() {
+	// Move every full batch of cached blocks to the depot, where other threads can use them, and return the rest.
+	struct MemoryThreadCacheT* cache = LocalThreadCache;
+	if (cache) {
+		for (U32 sizeClass = 0; sizeClass < MEMORY_SIZE_CLASS_COUNT; ++sizeClass) {
+			struct MemoryCacheBinT* bin = &cache->Bins[sizeClass];
+			while (bin->Count >= MEMORY_CACHE_BATCH_SIZE) { Depot_Push(CacheBin_PopBatch(bin), sizeClass); }
+			FreeCachedBlocks(bin->Head, sizeClass);
+			bin->Head  = NULL;
+			bin->Count = 0;
+		}
+		LocalThreadCache = NULL;
+		atomic_flag_clear_explicit(&cache->InUse, memory_order_release);
+	}
+
+	// Return the scratch allocator's pages, keeping only the page holding the allocator itself.
+	struct MemoryScratchStateT* scratch = LocalScratchState;
+	if (scratch) {
+		AssertMsg(scratch->Depth == 0, "Thread exited with a scratch scope still open!");
+		scratch->Depth = 0;
+		VirtualArena_SetUsed(&scratch->Arena, (void*) (scratch + 1) - scratch->Arena.Base);
+		VirtualArena_Trim(&scratch->Arena);
+		LocalScratchState = NULL;
+		atomic_flag_clear_explicit(&scratch->InUse, memory_order_release);
+	}
+
+	// The statistics must keep counting towards the totals, so only the static shards stay with their thread.
+	struct MemoryStatShardT* shard = LocalStatShard;
+	if (shard && shard != &MainStatShard && shard != &SharedStatShard) {
+		LocalStatShard = NULL;
+		atomic_flag_clear_explicit(&shard->InUse, memory_order_release);
+	}
+}
+
+static B8 AllocatorsEqual(const MemoryAllocator* a, const MemoryAllocator* b) {
+	return a->Name == b->Name && a->UserData == b->UserData && a->Allocate == b->Allocate &&
+	       a->Reallocate == b->Reallocate && a->Free == b->Free && a->GetStats == b->GetStats;
+}
+
+B8 Memory_SetTagAllocator(MemoryTag tag, const MemoryAllocator* allocator) {
+	AssertMsg(tag < MemoryTag_End, "Invalid memory tag!");
+	if (allocator == NULL) {
+		atomic_store_explicit(&TagAllocators[tag], DefaultAllocator, memory_order_release);
+		return TRUE;
+	}
+	AssertMsg(allocator->Allocate && allocator->Free, "Custom allocators must be able to allocate and free!");
+
+	// Share a slot with an identical allocator which is already registered, so slots aren't used up by routing several
+	// tags to the same allocator.
+	U32 index = 1;
+	while (index < AllocatorCount && !AllocatorsEqual(&Allocators[index], allocator)) { ++index; }
+	if (index == AllocatorCount) {
+		if (AllocatorCount == MEMORY_MAX_ALLOCATORS) {
+			LogE("[Memory] Cannot register allocator '%s', only %d allocators may be registered!",
+			     allocator->Name,
+			     MEMORY_MAX_ALLOCATORS);
+			return FALSE;
+		}
+		Allocators[AllocatorCount++] = *allocator;
+	}
+
+	LogD("[Memory] Routing '%s' allocations to allocator '%s'.", MemoryTagNames[tag], allocator->Name);
+	atomic_store_explicit(&TagAllocators[tag], index, memory_order_release);
+
+	return TRUE;
+}
+
+// Memory_Allocate(), Memory_AllocateAligned() and Memory_Reallocate() are parenthesized so that they are still defined
+// as functions when allocation tracking replaces them with macros.
+
+void*(Memory_Allocate)(size_t size, MemoryTag tag) {
 	// An allocation of 0 bytes is treated the same as if it were unaligned.
-	return Memory_AllocateAligned(size, 0, tag);
+	return _Memory_AllocateAt(size, 0, tag, MemoryFlag_None, NULL, 0);
+}
+
+void*(Memory_AllocateAligned)(size_t size, size_t align, MemoryTag tag) {
+	return _Memory_AllocateAt(size, align, tag, MemoryFlag_None, NULL, 0);
 }
 
-void* Memory_AllocateAligned(size_t size, U8 align, MemoryTag tag) {
+void*(Memory_AllocateHuge)(size_t size, size_t align, MemoryTag tag) {
+	return _Memory_AllocateAt(size, align, tag, MemoryFlag_HugePages, NULL, 0);
+}
+
+void* _Memory_AllocateAt(
+	size_t size, size_t align, MemoryTag tag, MemoryFlags flags, const char* file, U32 line) {
 	// Refuse to allocate a block of 0 bytes.
 	if (size == 0) { return NULL; }
 
-	// Validate the memory tag used.
+	// Validate the memory tag and alignment used. An alignment of 0 is treated the same as 1.
 	AssertMsg(tag < MemoryTag_End, "Invalid memory tag!");
+	AssertMsg((align & (align - 1)) == 0, "Allocation alignment must be a power of two!");
+	if (align == 0) { align = 1; }
 	if (tag == MemoryTag_Unknown) {
-		LogW("[Memory] Allocating %lld bytes under 'Unknown'. Consider classifying this allocation.");
+		LogW("[Memory] Allocating %lld bytes under 'Unknown'. Consider classifying this allocation.", size);
 	}
 
 	const size_t trackingOverhead = GetTrackingOverhead(align);
-	const size_t actualSize       = size + trackingOverhead;
+	size_t actualSize             = size + trackingOverhead;
+
+	// Tags routed to a custom allocator bypass the built-in heaps entirely.
+	const U32 allocatorIndex = atomic_load_explicit(&TagAllocators[tag], memory_order_acquire);
+	if (allocatorIndex != 0) { flags &= ~MemoryFlag_HugePages; }
+
+	// Huge pages are only worth it for allocations which would fill at least one of them, and can only provide
+	// alignments up to their own size. Decide this first, so that small huge page requests can use the thread caches.
+	const size_t hugePageSize = (flags & MemoryFlag_HugePages) ? Platform_GetHugePageSize() : 0;
+	if (actualSize < hugePageSize || align > hugePageSize) { flags &= ~MemoryFlag_HugePages; }
+
+	// Small blocks are rounded up to a size class so they can be recycled through the thread caches.
+	U32 sizeClass = 0;
+	if (flags == MemoryFlag_None && allocatorIndex == 0 && trackingOverhead == sizeof(struct AllocationT) &&
+	    size <= MEMORY_SIZE_CLASS_MAX) {
+		sizeClass  = GetSizeClass(size);
+		actualSize = GetSizeClassSize(sizeClass) + trackingOverhead;
+		flags |= ALLOCATION_FLAG_CACHED;
+	}
 
 	// Allocate the requested memory, plus a block large enough for our metadata.
-	// If alignment is 0, perform a normal allocation instead.
+	// If the platform heap already provides the alignment, perform a normal allocation instead.
 	void* ptr = NULL;
-	if (align == 0) {
+	if (allocatorIndex != 0) {
+		// The block must be aligned to at least our metadata, which is 16 bytes.
+		const MemoryAllocator* allocator = &Allocators[allocatorIndex];
+		ptr                              = allocator->Allocate(allocator->UserData, actualSize, trackingOverhead);
+	} else if (flags & ALLOCATION_FLAG_CACHED) {
+		void* cached = ThreadCache_Pop(sizeClass);
+		ptr          = cached ? cached - trackingOverhead : Platform_Alloc(actualSize);
+	} else if (flags & MemoryFlag_HugePages) {
+		// Huge page blocks are aligned to the huge page size, which satisfies the requested alignment.
+		const size_t blockSize = (actualSize + hugePageSize - 1) & ~(hugePageSize - 1);
+		B8 explicitHuge        = FALSE;
+		ptr                    = Platform_AllocHuge(blockSize, &explicitHuge);
+		if (ptr) { Memory_RegisterHugeRegion(ptr, blockSize, tag, explicitHuge); }
+	} else if (!NeedsAlignedAllocation(align)) {
 		ptr = Platform_Alloc(actualSize);
 	} else {
 		ptr = Platform_AllocAligned(actualSize, align);
@@ -117,38 +823,105 @@ void* Memory_AllocateAligned(size_t size, U8 align, MemoryTag tag) {
 	// This may leave empty bytes at the beginning of the actual allocation.
 	struct AllocationT* tracking = GetAllocationMetadata(returnPtr);
 	tracking->Size               = size;
-	tracking->Alignment          = align;
 	tracking->Tag                = tag;
+	tracking->Flags              = flags;
+	tracking->AlignmentShift     = GetAlignmentShift(align);
+	tracking->Allocator          = allocatorIndex;
 
-	// Update memory statistics.
-	MemoryStats.TotalAllocations++;
-	MemoryStats.AllocationsByTag[tag]++;
-	MemoryStats.TotalAllocatedBytes += actualSize;
-	MemoryStats.AllocatedBytesByTag[MemoryTag_Internal] += trackingOverhead;
-	MemoryStats.AllocatedBytesByTag[tag] += size;
+	// Update memory statistics. Any bytes beyond what the user asked for count as internal overhead.
+	const size_t blockSize         = GetBlockSize(tracking);
+	struct MemoryStatShardT* stats = GetStatShard();
+	StatAdd(stats, &stats->TotalAllocations, 1);
+	StatAdd(stats, &stats->AllocationsByTag[tag], 1);
+	StatAdd(stats, &stats->TotalAllocatedBytes, blockSize);
+	StatAdd(stats, &stats->AllocatedBytesByTag[MemoryTag_Internal], blockSize - size);
+	StatAdd(stats, &stats->AllocatedBytesByTag[tag], size);
+	StatRecordAllocation(stats, tag, size);
+
+#if OBSIDIAN_MEMORY_TRACKING == 1
+	MemoryTracking_Add(returnPtr, size, tag, file, line);
+#endif
 
 	return returnPtr;
 }
 
-void* Memory_Reallocate(void* ptr, size_t size) {
+size_t Memory_GetGoodSize(size_t size, MemoryTag tag) {
+	if (size == 0) { return 0; }
+
+	// Custom allocators don't tell us how they round their blocks.
+	if (atomic_load_explicit(&TagAllocators[tag], memory_order_acquire) != 0) { return size; }
+
+	// Small blocks take up their whole size class, see _Memory_AllocateAt().
+	if (size <= MEMORY_SIZE_CLASS_MAX) { return GetSizeClassSize(GetSizeClass(size)); }
+
+	// Large blocks are generally served from whole pages by the platform heap, so the rest of their last page is free.
+	const size_t trackingOverhead = GetTrackingOverhead(0);
+	if (size + trackingOverhead >= MEMORY_PAGE_ROUNDING_MIN) {
+		const size_t pageSize = Platform_GetPageSize();
+		return ((size + trackingOverhead + pageSize - 1) & ~(pageSize - 1)) - trackingOverhead;
+	}
+
+	return size;
+}
+
+void*(Memory_Reallocate)(void* ptr, size_t size) {
+	return _Memory_ReallocateAt(ptr, size, NULL, 0);
+}
+
+void* _Memory_ReallocateAt(void* ptr, size_t size, const char* file, U32 line) {
 	if (ptr == NULL) { return NULL; }
 
 	// Fetch allocation metadata and find our actual pointer.
 	struct AllocationT* tracking  = GetAllocationMetadata(ptr);
-	const size_t trackingOverhead = GetTrackingOverhead(tracking->Alignment);
+	const size_t align            = GetAlignment(tracking);
+	const size_t trackingOverhead = GetTrackingOverhead(align);
 	const size_t oldSize          = tracking->Size;
-	const size_t actualSize       = oldSize + trackingOverhead;
-	void* actualPtr               = ptr - trackingOverhead;
+
+	if ((tracking->Flags & ALLOCATION_FLAG_CACHED) && size <= MEMORY_SIZE_CLASS_MAX &&
+	    GetSizeClass(size) == GetSizeClass(oldSize)) {
+		// The block still fits its size class, so only the statistics change.
+		tracking->Size                 = size;
+		struct MemoryStatShardT* stats = GetStatShard();
+		StatAdd(stats, &stats->AllocatedBytesByTag[tracking->Tag], size - oldSize);
+		StatSub(stats, &stats->AllocatedBytesByTag[MemoryTag_Internal], size - oldSize);
+		StatRecordFree(stats, tracking->Tag, oldSize);
+		StatRecordAllocation(stats, tracking->Tag, size);
+
+#if OBSIDIAN_MEMORY_TRACKING == 1
+		MemoryTracking_Remove(ptr);
+		MemoryTracking_Add(ptr, size, tracking->Tag, file, line);
+#endif
+
+		return ptr;
+	}
+
+	const MemoryAllocator* allocator = tracking->Allocator != 0 ? &Allocators[tracking->Allocator] : NULL;
+	if ((tracking->Flags & (MemoryFlag_HugePages | ALLOCATION_FLAG_CACHED)) ||
+	    (allocator && allocator->Reallocate == NULL)) {
+		// Huge page and size-classed blocks can't be resized in place, so move to a new allocation.
+		const MemoryFlags flags = tracking->Flags & ~ALLOCATION_FLAG_CACHED;
+		void* newPtr            = _Memory_AllocateAt(size, align, tracking->Tag, flags, file, line);
+		if (newPtr == NULL) { return NULL; }
+		Memory_Copy(newPtr, ptr, oldSize < size ? oldSize : size);
+		Memory_Free(ptr);
+
+		return newPtr;
+	}
+
+	const size_t actualSize = oldSize + trackingOverhead;
+	void* actualPtr         = ptr - trackingOverhead;
 
 	// Calculate our new size.
 	const size_t newActualSize = size + trackingOverhead;
 
 	// Reallocate and get our new pointer.
 	void* newActualPtr = NULL;
-	if (tracking->Alignment == 0) {
+	if (allocator) {
+		newActualPtr = allocator->Reallocate(allocator->UserData, actualPtr, actualSize, newActualSize, trackingOverhead);
+	} else if (!NeedsAlignedAllocation(align)) {
 		newActualPtr = Platform_Realloc(actualPtr, newActualSize);
 	} else {
-		newActualPtr = Platform_ReallocAligned(actualPtr, tracking->Alignment, newActualSize);
+		newActualPtr = Platform_ReallocAligned(actualPtr, align, newActualSize);
 	}
 	if (newActualPtr == NULL) {
 		LogE("[Memory] Failed to reallocate '%s' memory from %lld to %lld bytes!",
@@ -163,8 +936,16 @@ void* Memory_Reallocate(void* ptr, size_t size) {
 	// Update metadata and statistics.
 	struct AllocationT* newTracking = GetAllocationMetadata(returnPtr);
 	newTracking->Size               = size;
-	MemoryStats.TotalAllocatedBytes += (newActualSize - actualSize);
-	MemoryStats.AllocatedBytesByTag[newTracking->Tag] += (size - oldSize);
+	struct MemoryStatShardT* stats  = GetStatShard();
+	StatAdd(stats, &stats->TotalAllocatedBytes, newActualSize - actualSize);
+	StatAdd(stats, &stats->AllocatedBytesByTag[newTracking->Tag], size - oldSize);
+	StatRecordFree(stats, newTracking->Tag, oldSize);
+	StatRecordAllocation(stats, newTracking->Tag, size);
+
+#if OBSIDIAN_MEMORY_TRACKING == 1
+	MemoryTracking_Remove(ptr);
+	MemoryTracking_Add(returnPtr, size, newTracking->Tag, file, line);
+#endif
 
 	return returnPtr;
 }
@@ -174,43 +955,226 @@ void Memory_Free(void* ptr) {
 
 	// Fetch allocation metadata and find our actual pointer.
 	struct AllocationT* tracking  = GetAllocationMetadata(ptr);
-	const size_t trackingOverhead = GetTrackingOverhead(tracking->Alignment);
-	const size_t actualSize       = tracking->Size + trackingOverhead;
+	const size_t trackingOverhead = GetTrackingOverhead(GetAlignment(tracking));
+	const size_t actualSize       = GetBlockSize(tracking);
 	void* actualPtr               = ptr - trackingOverhead;
 
-#if OBSIDIAN_DEBUG == 1
-	// Perform sanity checks against double-frees.
-	if (MemoryStats.TotalAllocations == 0) {
-		LogE("[Memory] Possible double-free: Freeing allocation with 0 total tracked allocations!");
-	}
-	if (MemoryStats.TotalAllocatedBytes < actualSize) {
-		LogE("[Memory] Possible double-free: Freeing allocation of %lld bytes with %lld total tracked bytes!",
-		     actualSize,
-		     MemoryStats.TotalAllocatedBytes);
-	}
-	if (MemoryStats.AllocatedBytesByTag[tracking->Tag] < tracking->Size) {
-		LogE("[Memory] Possible double-free: Freeing '%s' allocation of %lld bytes with %lld tracked bytes!",
-		     MemoryTagNames[tracking->Tag],
-		     actualSize,
-		     MemoryStats.TotalAllocatedBytes);
-	}
+#if OBSIDIAN_MEMORY_TRACKING == 1
+	MemoryTracking_Remove(ptr);
 #endif
 
 	// Update memory statistics.
-	MemoryStats.TotalAllocations--;
-	MemoryStats.TotalAllocatedBytes -= actualSize;
-	MemoryStats.AllocationsByTag[tracking->Tag]--;
-	MemoryStats.AllocatedBytesByTag[MemoryTag_Internal] -= trackingOverhead;
-	MemoryStats.AllocatedBytesByTag[tracking->Tag] -= tracking->Size;
+	struct MemoryStatShardT* stats = GetStatShard();
+	StatSub(stats, &stats->TotalAllocations, 1);
+	StatSub(stats, &stats->TotalAllocatedBytes, actualSize);
+	StatSub(stats, &stats->AllocationsByTag[tracking->Tag], 1);
+	StatSub(stats, &stats->AllocatedBytesByTag[MemoryTag_Internal], actualSize - tracking->Size);
+	StatSub(stats, &stats->AllocatedBytesByTag[tracking->Tag], tracking->Size);
+	StatRecordFree(stats, tracking->Tag, tracking->Size);
 
 	// Automatically deduce whether the allocation was aligned.
-	if (tracking->Alignment == 0) {
+	if (tracking->Allocator != 0) {
+		const MemoryAllocator* allocator = &Allocators[tracking->Allocator];
+		allocator->Free(allocator->UserData, actualPtr, actualSize, trackingOverhead);
+	} else if (tracking->Flags & ALLOCATION_FLAG_CACHED) {
+#if OBSIDIAN_DEBUG == 1
+		// Poison the block while it waits in the cache, to help catch it being used after free.
+		Memory_Set(ptr, 0xCD, actualSize - trackingOverhead);
+#endif
+		ThreadCache_Push(ptr, GetSizeClass(tracking->Size));
+	} else if (tracking->Flags & MemoryFlag_HugePages) {
+		Memory_UnregisterHugeRegion(actualPtr);
+		Platform_FreeHuge(actualPtr, actualSize);
+	} else if (!NeedsAlignedAllocation(GetAlignment(tracking))) {
 		Platform_Free(actualPtr);
 	} else {
 		Platform_FreeAligned(actualPtr);
 	}
 }
 
+void* Memory_FrameAlloc(size_t size, MemoryTag tag) {
+	return Memory_FrameAllocAligned(size, 0, tag);
+}
+
+void* Memory_FrameAllocAligned(size_t size, size_t align, MemoryTag tag) {
+	// Refuse to allocate a block of 0 bytes.
+	if (size == 0) { return NULL; }
+
+	AssertMsg(tag < MemoryTag_End, "Invalid memory tag!");
+	AssertMsg((align & (align - 1)) == 0, "Frame allocation alignment must be a power of two!");
+	if (align == 0) { align = FRAME_ARENA_DEFAULT_ALIGNMENT; }
+
+	struct FrameArenaT* arena = &FrameArenas[FrameArenaIndex];
+	void* ptr                 = FrameBlock_Allocate(arena->Blocks, size, align);
+	if (ptr == NULL) {
+		// Grow the arena by at least its current capacity, so an overflowing frame only needs a few new blocks.
+		size_t capacity = arena->Capacity > FRAME_ARENA_BLOCK_SIZE ? arena->Capacity : FRAME_ARENA_BLOCK_SIZE;
+		if (capacity < size + align) { capacity = size + align; }
+
+		struct FrameBlockT* block = FrameArena_AddBlock(arena, capacity);
+		if (block == NULL) {
+			LogE("[Memory] Failed to allocate %lld bytes of frame memory for %s!", size, MemoryTagNames[tag]);
+			return NULL;
+		}
+		ptr = FrameBlock_Allocate(block, size, align);
+	}
+
+	// Update memory statistics.
+	arena->AllocatedBytes += size;
+	arena->AllocationsByTag[tag]++;
+	arena->AllocatedBytesByTag[tag] += size;
+	MemoryStats.FrameAllocatedBytes += size;
+	MemoryStats.FrameAllocationsByTag[tag]++;
+	MemoryStats.FrameAllocatedBytesByTag[tag] += size;
+	if (arena->AllocatedBytes > MemoryStats.FramePeakBytes) { MemoryStats.FramePeakBytes = arena->AllocatedBytes; }
+
+	return ptr;
+}
+
+/** Record the heap activity since the previous call into the frame history. */
+static void FrameHistory_Record(size_t frameArenaBytes) {
+	MemoryFrameRecord totals;
+	Memory_Zero(&totals, sizeof(MemoryFrameRecord));
+	struct MemoryStatShardT* shard = atomic_load_explicit(&MemoryStatShards, memory_order_acquire);
+	for (; shard; shard = shard->Next) {
+		totals.LiveBytes += atomic_load_explicit(&shard->TotalAllocatedBytes, memory_order_relaxed);
+		for (U32 tag = 0; tag < MemoryTag_End; ++tag) {
+			totals.AllocationsByTag[tag] +=
+				atomic_load_explicit(&shard->AllocationsMadeByTag[tag], memory_order_relaxed);
+			totals.FreesByTag[tag] += atomic_load_explicit(&shard->FreesMadeByTag[tag], memory_order_relaxed);
+			totals.AllocatedBytesByTag[tag] +=
+				atomic_load_explicit(&shard->BytesAllocatedByTag[tag], memory_order_relaxed);
+			totals.FreedBytesByTag[tag] += atomic_load_explicit(&shard->BytesFreedByTag[tag], memory_order_relaxed);
+		}
+	}
+
+	const MemoryFrameRecord* baseline = &FrameHistory.Baseline;
+	MemoryFrameRecord* record         = &FrameHistory.Records[FrameHistory.FrameCount % MEMORY_FRAME_HISTORY_LENGTH];
+	Memory_Zero(record, sizeof(MemoryFrameRecord));
+	record->Frame           = FrameHistory.FrameCount;
+	record->LiveBytes       = totals.LiveBytes;
+	record->FrameArenaBytes = frameArenaBytes;
+	for (U32 tag = 0; tag < MemoryTag_End; ++tag) {
+		record->AllocationsByTag[tag]    = totals.AllocationsByTag[tag] - baseline->AllocationsByTag[tag];
+		record->FreesByTag[tag]          = totals.FreesByTag[tag] - baseline->FreesByTag[tag];
+		record->AllocatedBytesByTag[tag] = totals.AllocatedBytesByTag[tag] - baseline->AllocatedBytesByTag[tag];
+		record->FreedBytesByTag[tag]     = totals.FreedBytesByTag[tag] - baseline->FreedBytesByTag[tag];
+		record->Allocations += record->AllocationsByTag[tag];
+		record->Frees += record->FreesByTag[tag];
+		record->AllocatedBytes += record->AllocatedBytesByTag[tag];
+		record->FreedBytes += record->FreedBytesByTag[tag];
+	}
+
+	FrameHistory.Baseline = totals;
+	FrameHistory.FrameCount++;
+}
+
+void Memory_FrameReset() {
+	FrameHistory_Record(FrameArenas[FrameArenaIndex].AllocatedBytes);
+
+	FrameArenaIndex = (FrameArenaIndex + 1) % 2;
+	FrameArena_Reset(&FrameArenas[FrameArenaIndex]);
+}
+
+static struct MemoryScratchStateT* GetScratchState() {
+	struct MemoryScratchStateT* state = LocalScratchState;
+	if (state) { return state; }
+
+	// Take over the scratch allocator of a thread which has exited, if there is one.
+	state = atomic_load_explicit(&MemoryScratchStates, memory_order_acquire);
+	while (state && atomic_flag_test_and_set_explicit(&state->InUse, memory_order_acquire)) { state = state->Next; }
+	if (state) {
+		LocalScratchState = state;
+		return state;
+	}
+
+	VirtualArena arena;
+	if (!VirtualArena_Create(&arena, MEMORY_SCRATCH_RESERVE_SIZE, MemoryTag_Internal)) { return NULL; }
+	state = VirtualArena_Alloc(&arena, sizeof(struct MemoryScratchStateT), 0);
+	if (state == NULL) {
+		VirtualArena_Destroy(&arena);
+		return NULL;
+	}
+
+	// Move the arena into its own memory. From here on, we only touch it in place.
+	state->Arena = arena;
+	state->Depth = 0;
+	atomic_flag_test_and_set_explicit(&state->InUse, memory_order_relaxed);
+
+	struct MemoryScratchStateT* head = atomic_load_explicit(&MemoryScratchStates, memory_order_relaxed);
+	do {
+		state->Next = head;
+	} while (!atomic_compare_exchange_weak_explicit(
+		&MemoryScratchStates, &head, state, memory_order_release, memory_order_relaxed));
+
+	LocalScratchState = state;
+
+	return state;
+}
+
+MemoryScratch Memory_ScratchBegin() {
+	MemoryScratch scratch             = {0};
+	struct MemoryScratchStateT* state = GetScratchState();
+	if (state == NULL) {
+		LogE("[Memory] Failed to create scratch allocator for thread!");
+		return scratch;
+	}
+
+	state->Depth++;
+	scratch.Marker = state->Arena.Used;
+
+	return scratch;
+}
+
+void Memory_ScratchEnd(MemoryScratch scratch) {
+	struct MemoryScratchStateT* state = LocalScratchState;
+	if (state == NULL) { return; }
+
+	AssertMsg(state->Depth > 0, "Memory_ScratchEnd() called without a matching Memory_ScratchBegin()!");
+	AssertMsg(scratch.Marker <= state->Arena.Used, "Scratch scopes must end in the reverse order they began!");
+	VirtualArena_SetUsed(&state->Arena, scratch.Marker);
+	state->Depth--;
+}
+
+void* Memory_ScratchAlloc(size_t size) {
+	return Memory_ScratchAllocAligned(size, 0);
+}
+
+void* Memory_ScratchAllocAligned(size_t size, size_t align) {
+	// Refuse to allocate a block of 0 bytes.
+	if (size == 0) { return NULL; }
+
+	struct MemoryScratchStateT* state = LocalScratchState;
+	AssertMsg(state && state->Depth > 0, "Scratch allocations must be made inside a scratch scope!");
+	if (state == NULL) { return NULL; }
+
+	void* ptr = VirtualArena_Alloc(&state->Arena, size, align == 0 ? MEMORY_SCRATCH_DEFAULT_ALIGNMENT : align);
+	if (ptr == NULL) { LogE("[Memory] Failed to allocate %lld bytes of scratch memory!", size); }
+
+	return ptr;
+}
+
+void* Memory_ScratchRealloc(void* ptr, size_t oldSize, size_t newSize) {
+	if (ptr == NULL) { return Memory_ScratchAlloc(newSize); }
+
+	// The most recent allocation sits at the top of the arena, so it can simply grow or shrink.
+	struct MemoryScratchStateT* state = LocalScratchState;
+	AssertMsg(state && state->Depth > 0, "Scratch allocations must be made inside a scratch scope!");
+	if (ptr + oldSize == state->Arena.Base + state->Arena.Used) {
+		const size_t offset = ptr - state->Arena.Base;
+		if (!VirtualArena_SetUsed(&state->Arena, offset + newSize)) { return NULL; }
+
+		return ptr;
+	}
+	if (newSize <= oldSize) { return ptr; }
+
+	void* newPtr = Memory_ScratchAlloc(newSize);
+	if (newPtr == NULL) { return NULL; }
+	Memory_Copy(newPtr, ptr, oldSize);
+
+	return newPtr;
+}
+
 void Memory_Copy(void* dst, const void* src, size_t bytes) {
 	Platform_MemCopy(dst, src, bytes);
 }
@@ -227,18 +1191,251 @@ void Memory_Zero(void* dst, size_t bytes) {
 	Platform_MemZero(dst, bytes);
 }
 
+const char* Memory_GetTagName(MemoryTag tag) {
+	return tag < MemoryTag_End ? MemoryTagNames[tag] : "Invalid";
+}
+
+void Memory_GetUsage(MemoryUsage* usage) {
+	Memory_Zero(usage, sizeof(MemoryUsage));
+
+	struct MemoryStatShardT* shard = atomic_load_explicit(&MemoryStatShards, memory_order_acquire);
+	for (; shard; shard = shard->Next) {
+		usage->TotalAllocations += atomic_load_explicit(&shard->TotalAllocations, memory_order_relaxed);
+		usage->TotalAllocatedBytes += atomic_load_explicit(&shard->TotalAllocatedBytes, memory_order_relaxed);
+		for (U32 tag = 0; tag < MemoryTag_End; ++tag) {
+			usage->AllocationsByTag[tag] += atomic_load_explicit(&shard->AllocationsByTag[tag], memory_order_relaxed);
+			usage->AllocatedBytesByTag[tag] +=
+				atomic_load_explicit(&shard->AllocatedBytesByTag[tag], memory_order_relaxed);
+		}
+		usage->CachedBytes += atomic_load_explicit(&shard->CachedBytes, memory_order_relaxed);
+	}
+}
+
+void Memory_RegisterHugeRegion(void* ptr, size_t bytes, MemoryTag tag, B8 explicitHuge) {
+	while (atomic_flag_test_and_set_explicit(&HugeRegions.Lock, memory_order_acquire)) {}
+
+	if (HugeRegions.Count == HugeRegions.Capacity) {
+		const U32 newCapacity = HugeRegions.Capacity ? HugeRegions.Capacity * 2 : 16;
+		void* newRegions      = Platform_Realloc(HugeRegions.Regions, sizeof(struct HugeRegionT) * newCapacity);
+		if (newRegions == NULL) {
+			// The region will simply be missing from reports.
+			atomic_flag_clear_explicit(&HugeRegions.Lock, memory_order_release);
+			return;
+		}
+		HugeRegions.Regions  = newRegions;
+		HugeRegions.Capacity = newCapacity;
+	}
+	HugeRegions.Regions[HugeRegions.Count++] =
+		(struct HugeRegionT){.Ptr = ptr, .Bytes = bytes, .Tag = tag, .Explicit = explicitHuge};
+
+	atomic_flag_clear_explicit(&HugeRegions.Lock, memory_order_release);
+}
+
+void Memory_UnregisterHugeRegion(void* ptr) {
+	while (atomic_flag_test_and_set_explicit(&HugeRegions.Lock, memory_order_acquire)) {}
+
+	for (U32 i = 0; i < HugeRegions.Count; ++i) {
+		if (HugeRegions.Regions[i].Ptr == ptr) {
+			HugeRegions.Regions[i] = HugeRegions.Regions[--HugeRegions.Count];
+			break;
+		}
+	}
+
+	atomic_flag_clear_explicit(&HugeRegions.Lock, memory_order_release);
+}
+
+void Memory_LogAllocationSites(U32 count) {
+#if OBSIDIAN_MEMORY_TRACKING == 1
+	MemoryTracking_LogSites(count);
+#else
+	LogW("[Memory] Allocation sites are only recorded when OBSIDIAN_MEMORY_TRACKING is enabled.");
+#endif
+}
+
 void Memory_LogUsage() {
 	char buffer[64];
 
-	FormatMemoryUsage(buffer, 64, MemoryStats.TotalAllocatedBytes);
-	LogD("[Memory] Current Memory Usage: %s (%lld allocations)", buffer, MemoryStats.TotalAllocations);
+	MemoryUsage usage;
+	Memory_GetUsage(&usage);
+#if OBSIDIAN_DEBUG == 1
+	CheckForDoubleFrees(&usage);
+#endif
+
+	FormatMemoryUsage(buffer, 64, usage.TotalAllocatedBytes);
+	LogD("[Memory] Current Memory Usage: %s (%lld allocations)", buffer, usage.TotalAllocations);
 
 	for (U32 tag = 0; tag < MemoryTag_End; ++tag) {
-		const size_t bytes = MemoryStats.AllocatedBytesByTag[tag];
-		const size_t count = MemoryStats.AllocationsByTag[tag];
+		const size_t bytes = usage.AllocatedBytesByTag[tag];
+		const size_t count = usage.AllocationsByTag[tag];
 		if (count > 0 || bytes > 0) {
 			FormatMemoryUsage(buffer, 64, bytes);
 			LogD("[Memory] - %s: %s (%lld allocations)", MemoryTagNames[tag], buffer, count);
 		}
 	}
+	if (usage.CachedBytes > 0) {
+		FormatMemoryUsage(buffer, 64, usage.CachedBytes);
+		LogD("[Memory] Small-object caches hold %s of freed blocks for reuse", buffer);
+	}
+
+	if (MemoryStats.FramePeakBytes > 0) {
+		char peakBuffer[64];
+		FormatMemoryUsage(buffer, 64, MemoryStats.FrameAllocatedBytes);
+		FormatMemoryUsage(peakBuffer, 64, MemoryStats.FramePeakBytes);
+		LogD("[Memory] Current Frame Memory Usage: %s (peak %s in a single frame)", buffer, peakBuffer);
+
+		for (U32 tag = 0; tag < MemoryTag_End; ++tag) {
+			const size_t bytes = MemoryStats.FrameAllocatedBytesByTag[tag];
+			const size_t count = MemoryStats.FrameAllocationsByTag[tag];
+			if (count > 0 || bytes > 0) {
+				FormatMemoryUsage(buffer, 64, bytes);
+				LogD("[Memory] - %s: %s (%lld allocations)", MemoryTagNames[tag], buffer, count);
+			}
+		}
+	}
+
+	for (U32 index = 1; index < AllocatorCount; ++index) {
+		const MemoryAllocator* allocator = &Allocators[index];
+		if (allocator->GetStats == NULL) { continue; }
+
+		MemoryAllocatorStats allocatorStats = {0};
+		allocator->GetStats(allocator->UserData, &allocatorStats);
+		char reservedBuffer[64];
+		FormatMemoryUsage(buffer, 64, allocatorStats.UsedBytes);
+		FormatMemoryUsage(reservedBuffer, 64, allocatorStats.ReservedBytes);
+		LogD("[Memory] Allocator '%s': %s used of %s reserved", allocator->Name, buffer, reservedBuffer);
+	}
+
+	// Summarize heap churn over the frame history, which matters more than the totals in steady state.
+	const U32 historyCount =
+		FrameHistory.FrameCount < MEMORY_FRAME_HISTORY_LENGTH ? FrameHistory.FrameCount : MEMORY_FRAME_HISTORY_LENGTH;
+	if (historyCount > 0) {
+		size_t totalAllocations = 0, maxAllocations = 0, framesAllocating = 0;
+		for (U32 i = 0; i < historyCount; ++i) {
+			const size_t allocations = FrameHistory.Records[i].Allocations;
+			totalAllocations += allocations;
+			if (allocations > maxAllocations) { maxAllocations = allocations; }
+			if (allocations > 0) { ++framesAllocating; }
+		}
+		LogD("[Memory] Heap allocations over the last %u frames: %.1f per frame, at most %lld, in %lld frames",
+		     historyCount,
+		     (F64) totalAllocations / historyCount,
+		     maxAllocations,
+		     framesAllocating);
+	}
+
+	// Report how much of the memory which asked for huge pages actually got them.
+	while (atomic_flag_test_and_set_explicit(&HugeRegions.Lock, memory_order_acquire)) {}
+	if (HugeRegions.Count > 0) {
+		size_t requestedBytes[MemoryTag_End] = {0};
+		size_t hugeBytes[MemoryTag_End]      = {0};
+		for (U32 i = 0; i < HugeRegions.Count; ++i) {
+			const struct HugeRegionT* region = &HugeRegions.Regions[i];
+			requestedBytes[region->Tag] += region->Bytes;
+			hugeBytes[region->Tag] +=
+				region->Explicit ? region->Bytes : Platform_QueryHugePageBytes(region->Ptr, region->Bytes);
+		}
+
+		LogD("[Memory] Huge Page Usage:");
+		for (U32 tag = 0; tag < MemoryTag_End; ++tag) {
+			if (requestedBytes[tag] == 0) { continue; }
+			char requestedBuffer[64];
+			FormatMemoryUsage(buffer, 64, hugeBytes[tag]);
+			FormatMemoryUsage(requestedBuffer, 64, requestedBytes[tag]);
+			LogD("[Memory] - %s: %s of %s on huge pages", MemoryTagNames[tag], buffer, requestedBuffer);
+		}
+	}
+	atomic_flag_clear_explicit(&HugeRegions.Lock, memory_order_release);
+
+	MemoryPool_LogUsage();
+	VirtualArena_LogUsage();
+}
+
+U32 Memory_GetFrameHistory(MemoryFrameRecord* records, U32 maxRecords) {
+	const U32 available =
+		FrameHistory.FrameCount < MEMORY_FRAME_HISTORY_LENGTH ? FrameHistory.FrameCount : MEMORY_FRAME_HISTORY_LENGTH;
+	const U32 count = maxRecords < available ? maxRecords : available;
+
+	// Return the most recent records, starting from the oldest of them.
+	const U64 firstFrame = FrameHistory.FrameCount - count;
+	for (U32 i = 0; i < count; ++i) {
+		records[i] = FrameHistory.Records[(firstFrame + i) % MEMORY_FRAME_HISTORY_LENGTH];
+	}
+
+	return count;
+}
+
+B8 Memory_DumpFrameHistory(const char* path, MemoryDumpFormat format) {
+	FILE* f = fopen(path, "w");
+	if (f == NULL) {
+		LogE("[Memory] Failed to open '%s' to write the memory frame history!", path);
+		return FALSE;
+	}
+
+	const U32 count =
+		FrameHistory.FrameCount < MEMORY_FRAME_HISTORY_LENGTH ? FrameHistory.FrameCount : MEMORY_FRAME_HISTORY_LENGTH;
+	const U64 firstFrame = FrameHistory.FrameCount - count;
+
+	if (format == MemoryDumpFormat_CSV) {
+		fprintf(f, "frame,tag,allocations,frees,allocated_bytes,freed_bytes,live_bytes,frame_arena_bytes\n");
+		for (U32 i = 0; i < count; ++i) {
+			const MemoryFrameRecord* r = &FrameHistory.Records[(firstFrame + i) % MEMORY_FRAME_HISTORY_LENGTH];
+			fprintf(f,
+			        "%llu,Total,%zu,%zu,%zu,%zu,%zu,%zu\n",
+			        r->Frame,
+			        r->Allocations,
+			        r->Frees,
+			        r->AllocatedBytes,
+			        r->FreedBytes,
+			        r->LiveBytes,
+			        r->FrameArenaBytes);
+			for (U32 tag = 0; tag < MemoryTag_End; ++tag) {
+				if (r->AllocationsByTag[tag] == 0 && r->FreesByTag[tag] == 0) { continue; }
+				fprintf(f,
+				        "%llu,%s,%zu,%zu,%zu,%zu,,\n",
+				        r->Frame,
+				        MemoryTagNames[tag],
+				        r->AllocationsByTag[tag],
+				        r->FreesByTag[tag],
+				        r->AllocatedBytesByTag[tag],
+				        r->FreedBytesByTag[tag]);
+			}
+		}
+	} else {
+		fprintf(f, "[");
+		for (U32 i = 0; i < count; ++i) {
+			const MemoryFrameRecord* r = &FrameHistory.Records[(firstFrame + i) % MEMORY_FRAME_HISTORY_LENGTH];
+			fprintf(f,
+			        "%s\n  {\"frame\": %llu, \"allocations\": %zu, \"frees\": %zu, \"allocatedBytes\": %zu, "
+			        "\"freedBytes\": %zu, \"liveBytes\": %zu, \"frameArenaBytes\": %zu, \"tags\": {",
+			        i > 0 ? "," : "",
+			        r->Frame,
+			        r->Allocations,
+			        r->Frees,
+			        r->AllocatedBytes,
+			        r->FreedBytes,
+			        r->LiveBytes,
+			        r->FrameArenaBytes);
+			B8 first = TRUE;
+			for (U32 tag = 0; tag < MemoryTag_End; ++tag) {
+				if (r->AllocationsByTag[tag] == 0 && r->FreesByTag[tag] == 0) { continue; }
+				fprintf(f,
+				        "%s\"%s\": {\"allocations\": %zu, \"frees\": %zu, \"allocatedBytes\": %zu, \"freedBytes\": %zu}",
+				        first ? "" : ", ",
+				        MemoryTagNames[tag],
+				        r->AllocationsByTag[tag],
+				        r->FreesByTag[tag],
+				        r->AllocatedBytesByTag[tag],
+				        r->FreedBytesByTag[tag]);
+				first = FALSE;
+			}
+			fprintf(f, "}}");
+		}
+		fprintf(f, "\n]\n");
+	}
+
+	const B8 success = ferror(f) == 0;
+	fclose(f);
+	if (!success) { LogE("[Memory] Failed to write the memory frame history to '%s'!", path); }
+
+	return success;
 }
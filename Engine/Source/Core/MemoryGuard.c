@@ -0,0 +1,168 @@
+#include <Obsidian/Core/MemoryGuard.h>
+
+#if OBSIDIAN_MEMORY_GUARD == 1
+#	include <Obsidian/Core/Logger.h>
+#	include <Obsidian/Platform/Platform.h>
+#	include <stdatomic.h>
+#	include <stdint.h>
+
+/** Mebibytes of freed blocks kept in quarantine before their address space is reused. A larger quarantine catches uses
+ * after free over a longer window, at the cost of holding on to more memory. */
+#	ifndef OBSIDIAN_MEMORY_GUARD_QUARANTINE_MB
+#		define OBSIDIAN_MEMORY_GUARD_QUARANTINE_MB 64
+#	endif
+#	define MEMORY_GUARD_QUARANTINE_BYTES ((size_t) OBSIDIAN_MEMORY_GUARD_QUARANTINE_MB * 1024 * 1024)
+/** Maximum number of freed blocks kept in quarantine, however small they are. */
+#	define MEMORY_GUARD_QUARANTINE_BLOCKS 4096
+
+/**
+ * The reservation holding a single block. Every block gets its own reservation, laid out as committed pages holding
+ * the block followed by a guard page which is never committed, so that touching it faults.
+ */
+struct GuardRegionT {
+	void* Base;
+	size_t Bytes;          // Size of the whole reservation, including the guard page.
+	size_t CommittedBytes; // Size of the committed pages which end at the guard page.
+};
+
+static struct {
+	atomic_flag Lock;
+
+	// Ring buffer of freed regions, oldest first. Their pages can't be accessed, and their address space can't be handed
+	// out again until they leave the quarantine.
+	struct GuardRegionT Quarantine[MEMORY_GUARD_QUARANTINE_BLOCKS];
+	U32 QuarantineHead;
+	U32 QuarantineCount;
+	size_t QuarantineBytes;
+
+	atomic_size_t LiveBytes; // Committed bytes of blocks which are still live.
+} MemoryGuard;
+
+static uintptr_t AlignUp(uintptr_t value, size_t align) {
+	return (value + align - 1) & ~((uintptr_t) align - 1);
+}
+
+static uintptr_t AlignDown(uintptr_t value, size_t align) {
+	return value & ~((uintptr_t) align - 1);
+}
+
+/**
+ * Find the region a block belongs to. Blocks end as close to their guard page as their alignment allows, so for
+ * alignments up to the page size, the region can be worked out from the block alone.
+ */
+static struct GuardRegionT GetRegion(void* ptr, size_t size, size_t align) {
+	const size_t pageSize = Platform_GetPageSize();
+	if (align > pageSize) {
+		// Over-aligned blocks may start many pages into their reservation, which is recorded just before them.
+		return ((struct GuardRegionT*) ptr)[-1];
+	}
+
+	const size_t dataBytes = AlignUp(size, pageSize);
+	void* guard            = (void*) AlignUp((uintptr_t) ptr + size, pageSize);
+
+	return (struct GuardRegionT){.Base = guard - dataBytes, .Bytes = dataBytes + pageSize, .CommittedBytes = dataBytes};
+}
+
+/** Return the oldest region in quarantine to the system. The lock must be held. */
+static void Quarantine_ReleaseOldest() {
+	const struct GuardRegionT* oldest = &MemoryGuard.Quarantine[MemoryGuard.QuarantineHead];
+	Platform_VirtualRelease(oldest->Base, oldest->Bytes);
+	MemoryGuard.QuarantineBytes -= oldest->CommittedBytes;
+	MemoryGuard.QuarantineHead = (MemoryGuard.QuarantineHead + 1) % MEMORY_GUARD_QUARANTINE_BLOCKS;
+	MemoryGuard.QuarantineCount--;
+}
+
+static void* Guard_Allocate(void* userData, size_t size, size_t align) {
+	const size_t pageSize = Platform_GetPageSize();
+
+	// Over-aligned blocks need up to a whole alignment of padding, plus room before them for their region record.
+	const size_t dataBytes   = AlignUp(size, pageSize) + (align > pageSize ? align : 0);
+	const size_t regionBytes = dataBytes + pageSize;
+	void* base               = Platform_VirtualReserve(regionBytes);
+	if (base == NULL) {
+		LogE("[Memory] Guard page allocator failed to reserve %lld bytes. The system may limit how many mappings a "
+		     "process can have.",
+		     regionBytes);
+		return NULL;
+	}
+
+	// Place the block so that it ends against the guard page, leaving less than its alignment in between.
+	void* guard     = base + dataBytes;
+	void* ptr       = (void*) AlignDown((uintptr_t) (guard - size), align);
+	void* committed = align > pageSize ? ptr - pageSize : base;
+	if (!Platform_VirtualCommit(committed, guard - committed)) {
+		Platform_VirtualRelease(base, regionBytes);
+		return NULL;
+	}
+	if (align > pageSize) {
+		((struct GuardRegionT*) ptr)[-1] =
+			(struct GuardRegionT){.Base = base, .Bytes = regionBytes, .CommittedBytes = guard - committed};
+	}
+	atomic_fetch_add_explicit(&MemoryGuard.LiveBytes, guard - committed, memory_order_relaxed);
+
+	return ptr;
+}
+
+static void Guard_Free(void* userData, void* ptr, size_t size, size_t align) {
+	const struct GuardRegionT region = GetRegion(ptr, size, align);
+	const size_t pageSize            = Platform_GetPageSize();
+	atomic_fetch_sub_explicit(&MemoryGuard.LiveBytes, region.CommittedBytes, memory_order_relaxed);
+
+	// Forbid any access to the block, but keep its contents so that they can still be inspected from a debugger.
+	void* committed = region.Base + region.Bytes - pageSize - region.CommittedBytes;
+	Platform_VirtualProtect(committed, region.CommittedBytes, PlatformPageAccess_None);
+
+	while (atomic_flag_test_and_set_explicit(&MemoryGuard.Lock, memory_order_acquire)) {}
+
+	// Make room by returning the oldest regions to the system. A block larger than the whole quarantine is returned
+	// straight away.
+	while (MemoryGuard.QuarantineCount == MEMORY_GUARD_QUARANTINE_BLOCKS ||
+	       (MemoryGuard.QuarantineCount > 0 &&
+	        MemoryGuard.QuarantineBytes + region.CommittedBytes > MEMORY_GUARD_QUARANTINE_BYTES)) {
+		Quarantine_ReleaseOldest();
+	}
+	if (region.CommittedBytes > MEMORY_GUARD_QUARANTINE_BYTES) {
+		Platform_VirtualRelease(region.Base, region.Bytes);
+	} else {
+		const U32 tail = (MemoryGuard.QuarantineHead + MemoryGuard.QuarantineCount) % MEMORY_GUARD_QUARANTINE_BLOCKS;
+		MemoryGuard.Quarantine[tail] = region;
+		MemoryGuard.QuarantineBytes += region.CommittedBytes;
+		MemoryGuard.QuarantineCount++;
+	}
+
+	atomic_flag_clear_explicit(&MemoryGuard.Lock, memory_order_release);
+}
+
+static void Guard_GetStats(void* userData, MemoryAllocatorStats* stats) {
+	while (atomic_flag_test_and_set_explicit(&MemoryGuard.Lock, memory_order_acquire)) {}
+	const size_t quarantineBytes = MemoryGuard.QuarantineBytes;
+	atomic_flag_clear_explicit(&MemoryGuard.Lock, memory_order_release);
+
+	stats->UsedBytes     = atomic_load_explicit(&MemoryGuard.LiveBytes, memory_order_relaxed);
+	stats->ReservedBytes = stats->UsedBytes + quarantineBytes;
+}
+
+static const MemoryAllocator GuardAllocator = {
+	.Name = "Guard", .Allocate = Guard_Allocate, .Free = Guard_Free, .GetStats = Guard_GetStats};
+
+void MemoryGuard_Initialize() {
+	atomic_flag_clear(&MemoryGuard.Lock);
+	MemoryGuard.QuarantineHead  = 0;
+	MemoryGuard.QuarantineCount = 0;
+	MemoryGuard.QuarantineBytes = 0;
+	atomic_store(&MemoryGuard.LiveBytes, 0);
+
+	// Every block takes at least one page plus a guard page, and needs mappings of its own which most systems limit
+	// the number of, so this is only suitable for catching bugs.
+	LogW("[Memory] Guard pages are enabled, with a %d MiB quarantine. Allocations will be slow and use more memory.",
+	     OBSIDIAN_MEMORY_GUARD_QUARANTINE_MB);
+}
+
+void MemoryGuard_Shutdown() {
+	while (MemoryGuard.QuarantineCount > 0) { Quarantine_ReleaseOldest(); }
+}
+
+const MemoryAllocator* MemoryGuard_GetAllocator() {
+	return &GuardAllocator;
+}
+#endif
@@ -0,0 +1,167 @@
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/MemoryPool.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+/** Alignment used for pool elements which do not request one. */
+#define MEMORY_POOL_DEFAULT_ALIGNMENT 16
+
+/** Totals across every pool. Each pool belongs to one thread, but pools on different threads share these counters. */
+struct MemoryPoolStatsT {
+	atomic_size_t PoolsByTag[MemoryTag_End];
+	atomic_size_t ElementsInUseByTag[MemoryTag_End];
+	atomic_size_t ElementCapacityByTag[MemoryTag_End];
+	atomic_size_t ElementsHighWaterByTag[MemoryTag_End];
+};
+static struct MemoryPoolStatsT MemoryPoolStats;
+
+/** Header placed at the start of every chunk, linking it to the next. */
+struct MemoryPoolChunkT {
+	struct MemoryPoolChunkT* Next;
+};
+
+static size_t AlignUp(size_t value, size_t align) {
+	return (value + align - 1) & ~(align - 1);
+}
+
+/** Bytes at the start of each chunk reserved for the chunk header, keeping the first element aligned. */
+static size_t GetChunkHeaderSize(const MemoryPool* pool) {
+	return AlignUp(sizeof(struct MemoryPoolChunkT), pool->Alignment);
+}
+
+static B8 MemoryPool_Grow(MemoryPool* pool) {
+	const size_t headerSize = GetChunkHeaderSize(pool);
+	const size_t chunkSize  = headerSize + (pool->ElementSize * pool->ElementsPerChunk);
+
+	struct MemoryPoolChunkT* chunk = Memory_AllocateAligned(chunkSize, pool->Alignment, pool->Tag);
+	if (chunk == NULL) { return FALSE; }
+
+	chunk->Next     = pool->Chunks;
+	pool->Chunks    = chunk;
+	pool->Cursor    = ((void*) chunk) + headerSize;
+	pool->CursorEnd = ((void*) chunk) + chunkSize;
+	pool->ElementCapacity += pool->ElementsPerChunk;
+	atomic_fetch_add_explicit(
+		&MemoryPoolStats.ElementCapacityByTag[pool->Tag], pool->ElementsPerChunk, memory_order_relaxed);
+
+	return TRUE;
+}
+
+B8 MemoryPool_Create(MemoryPool* pool, size_t elementSize, size_t align, U32 elementsPerChunk, MemoryTag tag) {
+	AssertMsg(tag < MemoryTag_End, "Invalid memory tag!");
+	AssertMsg((align & (align - 1)) == 0, "Pool alignment must be a power of two!");
+	if (elementSize == 0 || elementsPerChunk == 0) {
+		LogE("[MemoryPool] Cannot create a pool with %lld byte elements and %u elements per chunk!",
+		     elementSize,
+		     elementsPerChunk);
+		return FALSE;
+	}
+
+	Memory_Zero(pool, sizeof(MemoryPool));
+
+	// Every element must be able to hold a free list pointer once it is freed.
+	pool->Alignment        = align == 0 ? MEMORY_POOL_DEFAULT_ALIGNMENT : align;
+	pool->ElementSize      = AlignUp(elementSize < sizeof(void*) ? sizeof(void*) : elementSize, pool->Alignment);
+	pool->ElementsPerChunk = elementsPerChunk;
+	pool->Tag              = tag;
+
+	atomic_fetch_add_explicit(&MemoryPoolStats.PoolsByTag[tag], 1, memory_order_relaxed);
+
+	return TRUE;
+}
+
+void MemoryPool_Destroy(MemoryPool* pool) {
+	if (pool == NULL || pool->ElementSize == 0) { return; }
+
+#if OBSIDIAN_DEBUG == 1
+	if (pool->ElementsInUse != 0) {
+		LogW("[MemoryPool] Destroying '%s' pool with %lld elements still allocated!",
+		     Memory_GetTagName(pool->Tag),
+		     pool->ElementsInUse);
+	}
+#endif
+
+	struct MemoryPoolChunkT* chunk = pool->Chunks;
+	while (chunk) {
+		struct MemoryPoolChunkT* next = chunk->Next;
+		Memory_Free(chunk);
+		chunk = next;
+	}
+
+	atomic_fetch_sub_explicit(&MemoryPoolStats.PoolsByTag[pool->Tag], 1, memory_order_relaxed);
+	atomic_fetch_sub_explicit(&MemoryPoolStats.ElementsInUseByTag[pool->Tag], pool->ElementsInUse, memory_order_relaxed);
+	atomic_fetch_sub_explicit(
+		&MemoryPoolStats.ElementCapacityByTag[pool->Tag], pool->ElementCapacity, memory_order_relaxed);
+
+	Memory_Zero(pool, sizeof(MemoryPool));
+}
+
+void* MemoryPool_Alloc(MemoryPool* pool) {
+	void* ptr = NULL;
+
+	if (pool->FreeList) {
+		// Reuse the most recently freed element.
+		ptr            = pool->FreeList;
+		pool->FreeList = *(void**) ptr;
+	} else {
+		// Take a fresh element from the newest chunk, growing if it has run out.
+		if (pool->Cursor == pool->CursorEnd && !MemoryPool_Grow(pool)) {
+			LogE("[MemoryPool] Failed to grow '%s' pool by %u elements!",
+			     Memory_GetTagName(pool->Tag),
+			     pool->ElementsPerChunk);
+			return NULL;
+		}
+		ptr = pool->Cursor;
+		pool->Cursor += pool->ElementSize;
+	}
+
+	// Update pool statistics.
+	pool->ElementsInUse++;
+	if (pool->ElementsInUse > pool->ElementsHighWater) { pool->ElementsHighWater = pool->ElementsInUse; }
+	const size_t inUse =
+		atomic_fetch_add_explicit(&MemoryPoolStats.ElementsInUseByTag[pool->Tag], 1, memory_order_relaxed) + 1;
+	size_t highWater = atomic_load_explicit(&MemoryPoolStats.ElementsHighWaterByTag[pool->Tag], memory_order_relaxed);
+	while (inUse > highWater && !atomic_compare_exchange_weak_explicit(&MemoryPoolStats.ElementsHighWaterByTag[pool->Tag],
+	                                                                    &highWater,
+	                                                                    inUse,
+	                                                                    memory_order_relaxed,
+	                                                                    memory_order_relaxed)) {}
+
+	return ptr;
+}
+
+void MemoryPool_Free(MemoryPool* pool, void* ptr) {
+	if (ptr == NULL) { return; }
+
+#if OBSIDIAN_DEBUG == 1
+	if (pool->ElementsInUse == 0) {
+		LogE("[MemoryPool] Possible double-free: Freeing element from '%s' pool with no elements allocated!",
+		     Memory_GetTagName(pool->Tag));
+		return;
+	}
+	// Poison the freed element, to help catch use-after-free.
+	Memory_Set(ptr, 0xDD, pool->ElementSize);
+#endif
+
+	*(void**) ptr  = pool->FreeList;
+	pool->FreeList = ptr;
+
+	// Update pool statistics.
+	pool->ElementsInUse--;
+	atomic_fetch_sub_explicit(&MemoryPoolStats.ElementsInUseByTag[pool->Tag], 1, memory_order_relaxed);
+}
+
+void MemoryPool_LogUsage() {
+	for (U32 tag = 0; tag < MemoryTag_End; ++tag) {
+		const U64 pools     = atomic_load_explicit(&MemoryPoolStats.PoolsByTag[tag], memory_order_relaxed);
+		const U64 highWater = atomic_load_explicit(&MemoryPoolStats.ElementsHighWaterByTag[tag], memory_order_relaxed);
+		if (pools == 0 && highWater == 0) { continue; }
+
+		LogD("[MemoryPool] - %s: %llu/%llu elements in use (high-water %llu) across %llu pools",
+		     Memory_GetTagName(tag),
+		     (U64) atomic_load_explicit(&MemoryPoolStats.ElementsInUseByTag[tag], memory_order_relaxed),
+		     (U64) atomic_load_explicit(&MemoryPoolStats.ElementCapacityByTag[tag], memory_order_relaxed),
+		     highWater,
+		     pools);
+	}
+}
@@ -0,0 +1,361 @@
+#include <Obsidian/Core/MemoryTracking.h>
+
+#if OBSIDIAN_MEMORY_TRACKING == 1
+#	include <Obsidian/Core/Logger.h>
+#	include <Obsidian/Platform/Platform.h>
+#	include <stdatomic.h>
+#	include <stdint.h>
+#	include <stdlib.h>
+#	include <string.h>
+
+/** Number of return addresses recorded for each allocation site. Capturing call stacks is the most expensive part of
+ * tracking, so this can be set to 0 to record only the source location. */
+#	ifndef OBSIDIAN_MEMORY_TRACKING_FRAMES
+#		define OBSIDIAN_MEMORY_TRACKING_FRAMES 8
+#	endif
+#	define MEMORY_TRACKING_MAX_FRAMES (OBSIDIAN_MEMORY_TRACKING_FRAMES > 0 ? OBSIDIAN_MEMORY_TRACKING_FRAMES : 1)
+/** Frames belonging to the memory subsystem itself, which are left out of recorded call stacks. */
+#	define MEMORY_TRACKING_SKIP_FRAMES 2
+/** Number of entries the tables start with. Must be a power of two. */
+#	define MEMORY_TRACKING_INITIAL_CAPACITY 1024
+
+/** A unique combination of source location and call stack which has allocated memory. */
+struct AllocationSiteT {
+	const char* File;
+	U32 Line;
+	U32 FrameCount;
+	U64 Hash;
+	void* Frames[MEMORY_TRACKING_MAX_FRAMES];
+	size_t LiveBytes;
+	size_t LiveCount;
+	size_t TotalBytes;
+	size_t TotalCount;
+};
+
+/** A live allocation, stored in an open-addressing hash table keyed by pointer. */
+struct LiveAllocationT {
+	void* Ptr; // NULL marks an empty slot.
+	size_t Size;
+	U32 Tag;
+	U32 Site;
+};
+
+struct MemoryTrackingT {
+	atomic_flag Lock;
+
+	// Every site we have seen, in order of discovery. Site indices are stable, so live allocations can refer to them.
+	struct AllocationSiteT* Sites;
+	U32 SiteCount;
+	U32 SiteCapacity;
+
+	// Open-addressing index into Sites, keyed by site hash. Empty slots hold UINT32_MAX.
+	U32* SiteIndex;
+	U32 SiteIndexCapacity;
+
+	// Open-addressing table of live allocations, using linear probing.
+	struct LiveAllocationT* Live;
+	size_t LiveCount;
+	size_t LiveCapacity;
+
+	// Overhead measurement.
+	U64 Operations;
+	F64 Time;
+};
+static struct MemoryTrackingT Tracking = {.Lock = ATOMIC_FLAG_INIT};
+
+static void Tracking_Lock() {
+	while (atomic_flag_test_and_set_explicit(&Tracking.Lock, memory_order_acquire)) {}
+}
+
+static void Tracking_Unlock() {
+	atomic_flag_clear_explicit(&Tracking.Lock, memory_order_release);
+}
+
+static U64 HashPointer(const void* ptr) {
+	U64 h = (U64) (uintptr_t) ptr;
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdull;
+	h ^= h >> 33;
+
+	return h;
+}
+
+static U64 HashSite(const char* file, U32 line, void* const* frames, U32 frameCount) {
+	U64 h = 0xcbf29ce484222325ull;
+	h     = (h ^ (U64) (uintptr_t) file) * 0x100000001b3ull;
+	h     = (h ^ line) * 0x100000001b3ull;
+	for (U32 i = 0; i < frameCount; ++i) { h = (h ^ (U64) (uintptr_t) frames[i]) * 0x100000001b3ull; }
+
+	return h;
+}
+
+static B8 Tracking_GrowSiteIndex() {
+	const U32 newCapacity =
+		Tracking.SiteIndexCapacity ? Tracking.SiteIndexCapacity * 2 : MEMORY_TRACKING_INITIAL_CAPACITY;
+	U32* newIndex = Platform_Alloc(sizeof(U32) * newCapacity);
+	if (newIndex == NULL) { return FALSE; }
+	Platform_MemSet(newIndex, 0xff, sizeof(U32) * newCapacity);
+
+	for (U32 site = 0; site < Tracking.SiteCount; ++site) {
+		U32 slot = Tracking.Sites[site].Hash & (newCapacity - 1);
+		while (newIndex[slot] != UINT32_MAX) { slot = (slot + 1) & (newCapacity - 1); }
+		newIndex[slot] = site;
+	}
+
+	Platform_Free(Tracking.SiteIndex);
+	Tracking.SiteIndex         = newIndex;
+	Tracking.SiteIndexCapacity = newCapacity;
+
+	return TRUE;
+}
+
+/** Find the site for the given location and call stack, creating it if this is the first time we have seen it. */
+static U32 Tracking_FindSite(const char* file, U32 line, void* const* frames, U32 frameCount) {
+	const U64 hash = HashSite(file, line, frames, frameCount);
+
+	if (Tracking.SiteIndexCapacity > 0) {
+		U32 slot = hash & (Tracking.SiteIndexCapacity - 1);
+		while (Tracking.SiteIndex[slot] != UINT32_MAX) {
+			const struct AllocationSiteT* site = &Tracking.Sites[Tracking.SiteIndex[slot]];
+			if (site->Hash == hash && site->File == file && site->Line == line && site->FrameCount == frameCount &&
+			    memcmp(site->Frames, frames, sizeof(void*) * frameCount) == 0) {
+				return Tracking.SiteIndex[slot];
+			}
+			slot = (slot + 1) & (Tracking.SiteIndexCapacity - 1);
+		}
+	}
+
+	// Keep the site index at most half full.
+	if ((Tracking.SiteCount + 1) * 2 > Tracking.SiteIndexCapacity) {
+		if (!Tracking_GrowSiteIndex()) { return UINT32_MAX; }
+	}
+	if (Tracking.SiteCount == Tracking.SiteCapacity) {
+		const U32 newCapacity = Tracking.SiteCapacity ? Tracking.SiteCapacity * 2 : MEMORY_TRACKING_INITIAL_CAPACITY;
+		struct AllocationSiteT* newSites =
+			Platform_Realloc(Tracking.Sites, sizeof(struct AllocationSiteT) * newCapacity);
+		if (newSites == NULL) { return UINT32_MAX; }
+		Tracking.Sites        = newSites;
+		Tracking.SiteCapacity = newCapacity;
+	}
+
+	const U32 index              = Tracking.SiteCount++;
+	struct AllocationSiteT* site = &Tracking.Sites[index];
+	Platform_MemZero(site, sizeof(struct AllocationSiteT));
+	site->File       = file;
+	site->Line       = line;
+	site->FrameCount = frameCount;
+	site->Hash       = hash;
+	Platform_MemCopy(site->Frames, frames, sizeof(void*) * frameCount);
+
+	U32 slot = hash & (Tracking.SiteIndexCapacity - 1);
+	while (Tracking.SiteIndex[slot] != UINT32_MAX) { slot = (slot + 1) & (Tracking.SiteIndexCapacity - 1); }
+	Tracking.SiteIndex[slot] = index;
+
+	return index;
+}
+
+static void Tracking_InsertLive(struct LiveAllocationT* table, size_t capacity, const struct LiveAllocationT* entry) {
+	size_t slot = HashPointer(entry->Ptr) & (capacity - 1);
+	while (table[slot].Ptr != NULL) { slot = (slot + 1) & (capacity - 1); }
+	table[slot] = *entry;
+}
+
+static B8 Tracking_GrowLive() {
+	const size_t newCapacity = Tracking.LiveCapacity ? Tracking.LiveCapacity * 2 : MEMORY_TRACKING_INITIAL_CAPACITY;
+	struct LiveAllocationT* newLive = Platform_Alloc(sizeof(struct LiveAllocationT) * newCapacity);
+	if (newLive == NULL) { return FALSE; }
+	Platform_MemZero(newLive, sizeof(struct LiveAllocationT) * newCapacity);
+
+	for (size_t i = 0; i < Tracking.LiveCapacity; ++i) {
+		if (Tracking.Live[i].Ptr) { Tracking_InsertLive(newLive, newCapacity, &Tracking.Live[i]); }
+	}
+
+	Platform_Free(Tracking.Live);
+	Tracking.Live         = newLive;
+	Tracking.LiveCapacity = newCapacity;
+
+	return TRUE;
+}
+
+void MemoryTracking_Initialize() {
+	Platform_MemZero(&Tracking, sizeof(Tracking));
+	atomic_flag_clear(&Tracking.Lock);
+}
+
+void MemoryTracking_Shutdown() {
+	Tracking_Lock();
+
+	if (Tracking.LiveCount > 0) {
+		LogW("[Memory] %lld allocations were leaked:", Tracking.LiveCount);
+		for (size_t i = 0; i < Tracking.LiveCapacity; ++i) {
+			const struct LiveAllocationT* live = &Tracking.Live[i];
+			if (live->Ptr == NULL) { continue; }
+
+			const struct AllocationSiteT* site = &Tracking.Sites[live->Site];
+			LogW("[Memory] - %lld bytes of '%s' at %p, allocated at %s:%u",
+			     live->Size,
+			     Memory_GetTagName(live->Tag),
+			     live->Ptr,
+			     site->File ? site->File : "<unknown>",
+			     site->Line);
+			for (U32 frame = 0; frame < site->FrameCount; ++frame) {
+				char description[256];
+				Platform_DescribeAddress(site->Frames[frame], description, sizeof(description));
+				LogW("[Memory]     #%u %s", frame, description);
+			}
+		}
+	}
+
+	if (Tracking.Operations > 0) {
+		const size_t tableBytes = (sizeof(struct AllocationSiteT) * Tracking.SiteCapacity) +
+		                          (sizeof(U32) * Tracking.SiteIndexCapacity) +
+		                          (sizeof(struct LiveAllocationT) * Tracking.LiveCapacity);
+		LogI("[Memory] Allocation tracking overhead: %.3f ms over %llu operations (%.3f us each), %lld bytes of tables.",
+		     Tracking.Time * 1000.0,
+		     Tracking.Operations,
+		     (Tracking.Time * 1000000.0) / (F64) Tracking.Operations,
+		     tableBytes);
+	}
+
+	Platform_Free(Tracking.Sites);
+	Platform_Free(Tracking.SiteIndex);
+	Platform_Free(Tracking.Live);
+	Platform_MemZero(&Tracking, sizeof(Tracking));
+}
+
+void MemoryTracking_Add(void* ptr, size_t size, MemoryTag tag, const char* file, U32 line) {
+	const F64 startTime = Platform_GetAbsoluteTime();
+
+	// Capture the call stack before taking the lock, as it is the most expensive part of tracking.
+	void* frames[MEMORY_TRACKING_MAX_FRAMES];
+	U32 frameCount = 0;
+	if (OBSIDIAN_MEMORY_TRACKING_FRAMES > 0) {
+		frameCount = Platform_CaptureStackTrace(frames, OBSIDIAN_MEMORY_TRACKING_FRAMES, MEMORY_TRACKING_SKIP_FRAMES);
+	}
+
+	Tracking_Lock();
+
+	const U32 siteIndex = Tracking_FindSite(file, line, frames, frameCount);
+	if (siteIndex == UINT32_MAX) {
+		Tracking_Unlock();
+		return;
+	}
+
+	// Keep the live table at most three quarters full.
+	if ((Tracking.LiveCount + 1) * 4 > Tracking.LiveCapacity * 3 && !Tracking_GrowLive()) {
+		Tracking_Unlock();
+		return;
+	}
+
+	const struct LiveAllocationT entry = {.Ptr = ptr, .Size = size, .Tag = tag, .Site = siteIndex};
+	Tracking_InsertLive(Tracking.Live, Tracking.LiveCapacity, &entry);
+	Tracking.LiveCount++;
+
+	struct AllocationSiteT* site = &Tracking.Sites[siteIndex];
+	site->LiveBytes += size;
+	site->LiveCount++;
+	site->TotalBytes += size;
+	site->TotalCount++;
+
+	Tracking.Operations++;
+	Tracking.Time += Platform_GetAbsoluteTime() - startTime;
+
+	Tracking_Unlock();
+}
+
+void MemoryTracking_Remove(void* ptr) {
+	const F64 startTime = Platform_GetAbsoluteTime();
+
+	Tracking_Lock();
+
+	if (Tracking.LiveCapacity == 0) {
+		Tracking_Unlock();
+		return;
+	}
+
+	const size_t mask = Tracking.LiveCapacity - 1;
+	size_t slot       = HashPointer(ptr) & mask;
+	while (Tracking.Live[slot].Ptr != NULL && Tracking.Live[slot].Ptr != ptr) { slot = (slot + 1) & mask; }
+	if (Tracking.Live[slot].Ptr == NULL) {
+		// This allocation was made before tracking started, or could not be recorded.
+		Tracking_Unlock();
+		return;
+	}
+
+	struct AllocationSiteT* site = &Tracking.Sites[Tracking.Live[slot].Site];
+	site->LiveBytes -= Tracking.Live[slot].Size;
+	site->LiveCount--;
+
+	// Remove the entry with backward-shift deletion, so lookups never need tombstones.
+	size_t hole = slot;
+	size_t next = (hole + 1) & mask;
+	while (Tracking.Live[next].Ptr != NULL) {
+		const size_t home = HashPointer(Tracking.Live[next].Ptr) & mask;
+		// Move the entry into the hole if its home slot is not between the hole and its current slot.
+		if (((next - home) & mask) >= ((next - hole) & mask)) {
+			Tracking.Live[hole] = Tracking.Live[next];
+			hole                = next;
+		}
+		next = (next + 1) & mask;
+	}
+	Tracking.Live[hole].Ptr = NULL;
+	Tracking.LiveCount--;
+
+	Tracking.Operations++;
+	Tracking.Time += Platform_GetAbsoluteTime() - startTime;
+
+	Tracking_Unlock();
+}
+
+static int CompareSitesByLiveBytes(const void* a, const void* b) {
+	const struct AllocationSiteT* siteA = &Tracking.Sites[*(const U32*) a];
+	const struct AllocationSiteT* siteB = &Tracking.Sites[*(const U32*) b];
+
+	return (siteA->LiveBytes < siteB->LiveBytes) - (siteA->LiveBytes > siteB->LiveBytes);
+}
+
+static int CompareSitesByTotalCount(const void* a, const void* b) {
+	const struct AllocationSiteT* siteA = &Tracking.Sites[*(const U32*) a];
+	const struct AllocationSiteT* siteB = &Tracking.Sites[*(const U32*) b];
+
+	return (siteA->TotalCount < siteB->TotalCount) - (siteA->TotalCount > siteB->TotalCount);
+}
+
+static void LogSite(U32 rank, const struct AllocationSiteT* site) {
+	char caller[256] = "";
+	if (site->FrameCount > 0) { Platform_DescribeAddress(site->Frames[0], caller, sizeof(caller)); }
+
+	LogI("[Memory] %2u. %s:%u - %lld bytes live in %lld allocations, %lld allocations total (%s)",
+	     rank,
+	     site->File ? site->File : "<unknown>",
+	     site->Line,
+	     site->LiveBytes,
+	     site->LiveCount,
+	     site->TotalCount,
+	     caller);
+}
+
+void MemoryTracking_LogSites(U32 count) {
+	Tracking_Lock();
+
+	U32* order = Platform_Alloc(sizeof(U32) * (Tracking.SiteCount ? Tracking.SiteCount : 1));
+	if (order == NULL) {
+		Tracking_Unlock();
+		return;
+	}
+	for (U32 i = 0; i < Tracking.SiteCount; ++i) { order[i] = i; }
+	const U32 shown = count < Tracking.SiteCount ? count : Tracking.SiteCount;
+
+	LogI("[Memory] Top %u of %u allocation sites by live bytes:", shown, Tracking.SiteCount);
+	qsort(order, Tracking.SiteCount, sizeof(U32), CompareSitesByLiveBytes);
+	for (U32 i = 0; i < shown; ++i) { LogSite(i + 1, &Tracking.Sites[order[i]]); }
+
+	LogI("[Memory] Top %u of %u allocation sites by total allocations:", shown, Tracking.SiteCount);
+	qsort(order, Tracking.SiteCount, sizeof(U32), CompareSitesByTotalCount);
+	for (U32 i = 0; i < shown; ++i) { LogSite(i + 1, &Tracking.Sites[order[i]]); }
+
+	Platform_Free(order);
+
+	Tracking_Unlock();
+}
+#endif
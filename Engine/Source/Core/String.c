@@ -17,3 +17,33 @@ char* String_Duplicate(const char* str) {
 B8 String_Equal(const char* a, const char* b) {
 	return strcmp(a, b) == 0;
 }
+
+U32 String_Hash32(const char* str) {
+	U32 hash = 0x811C9DC5u;
+	for (; *str; ++str) {
+		hash ^= (U8) *str;
+		hash *= 0x01000193u;
+	}
+
+	return hash;
+}
+
+U64 String_Hash64(const char* str) {
+	U64 hash = 0xCBF29CE484222325ull;
+	for (; *str; ++str) {
+		hash ^= (U8) *str;
+		hash *= 0x100000001B3ull;
+	}
+
+	return hash;
+}
+
+U64 String_HashLength64(const char* str, U64 length) {
+	U64 hash = 0xCBF29CE484222325ull;
+	for (U64 i = 0; i < length; ++i) {
+		hash ^= (U8) str[i];
+		hash *= 0x100000001B3ull;
+	}
+
+	return hash;
+}
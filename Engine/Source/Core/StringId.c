@@ -0,0 +1,87 @@
+#include <Obsidian/Containers/Dictionary.h>
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+#include <Obsidian/Core/String.h>
+#include <Obsidian/Core/StringId.h>
+#include <Obsidian/Core/VirtualArena.h>
+#include <string.h>
+
+// Address space reserved for interned strings. Only what is used is committed.
+#define StringId_ArenaReserveSize (64ull * 1024 * 1024)
+
+typedef struct StringIdSystemT {
+	VirtualArena Arena;   // Holds a copy of every interned string, which is never freed until shutdown.
+	const char** Strings; // Maps each interned ID to its string within the arena.
+} StringIdSystemData;
+
+static StringIdSystemData StringIdSystem;
+
+B8 StringId_Initialize() {
+	Memory_Zero(&StringIdSystem, sizeof(StringIdSystemData));
+
+	if (!VirtualArena_Create(&StringIdSystem.Arena, StringId_ArenaReserveSize, MemoryTag_String)) {
+		LogE("[StringId] Failed to reserve memory for interned strings!");
+		return FALSE;
+	}
+
+	StringIdSystem.Strings = Dictionary_CreateInt(const char*);
+	if (StringIdSystem.Strings == NULL) {
+		LogE("[StringId] Failed to create interned string lookup!");
+		VirtualArena_Destroy(&StringIdSystem.Arena);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+void StringId_Shutdown() {
+	if (StringIdSystem.Strings == NULL) { return; }
+
+	Dictionary_Destroy(&StringIdSystem.Strings);
+	VirtualArena_Destroy(&StringIdSystem.Arena);
+	Memory_Zero(&StringIdSystem, sizeof(StringIdSystemData));
+}
+
+StringId StringId_Intern(const char* str) {
+	return StringId_InternLength(str, String_Length(str));
+}
+
+StringId StringId_InternLength(const char* str, U64 length) {
+	AssertMsg(StringIdSystem.Strings, "StringId system has not been initialized!");
+
+	const StringId id = String_HashLength64(str, length);
+
+	const char** existing = Dictionary_FindInt(&StringIdSystem.Strings, id);
+	if (existing) {
+		// Two different strings with the same ID would be treated as equal everywhere they are compared.
+		if (String_Length(*existing) != length || memcmp(*existing, str, length) != 0) {
+			LogE("[StringId] Hash collision between \"%s\" and \"%.*s\"!", *existing, (int) length, str);
+		}
+		return id;
+	}
+
+	char* copy = VirtualArena_Alloc(&StringIdSystem.Arena, length + 1, 1);
+	if (copy == NULL) {
+		LogE("[StringId] Ran out of memory for interned strings!");
+		return id;
+	}
+	Memory_Copy(copy, str, length);
+	copy[length] = '\0';
+
+	const char* interned = copy;
+	Dictionary_InsertInt(&StringIdSystem.Strings, id, interned);
+
+	return id;
+}
+
+StringId StringId_FromString(const char* str) {
+	return String_Hash64(str);
+}
+
+const char* StringId_GetString(StringId id) {
+	if (StringIdSystem.Strings == NULL) { return NULL; }
+
+	const char** interned = Dictionary_FindInt(&StringIdSystem.Strings, id);
+
+	return interned ? *interned : NULL;
+}
@@ -0,0 +1,158 @@
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/VirtualArena.h>
+#include <Obsidian/Platform/Platform.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+/** Minimum number of bytes committed at once, to avoid a system call for every small allocation. */
+#define VIRTUAL_ARENA_COMMIT_STEP (64 * 1024)
+/** Alignment used for arena allocations which do not request one. */
+#define VIRTUAL_ARENA_DEFAULT_ALIGNMENT 16
+
+// Arenas may be used from any thread, so statistics are kept with atomics. Commits are rare enough for this to be
+// cheap.
+struct VirtualArenaStatsT {
+	atomic_size_t ArenasByTag[MemoryTag_End];
+	atomic_size_t ReservedBytesByTag[MemoryTag_End];
+	atomic_size_t CommittedBytesByTag[MemoryTag_End];
+};
+static struct VirtualArenaStatsT VirtualArenaStats;
+
+static size_t AlignUp(size_t value, size_t align) {
+	return (value + align - 1) & ~(align - 1);
+}
+
+/** Get the granularity at which memory is committed to and decommitted from the arena. */
+static size_t GetPageSize(const VirtualArena* arena) {
+	return arena->HugePages ? Platform_GetHugePageSize() : Platform_GetPageSize();
+}
+
+/** Ensure at least the given number of bytes at the start of the arena are committed. */
+static B8 VirtualArena_Commit(VirtualArena* arena, size_t bytes) {
+	if (bytes <= arena->Committed) { return TRUE; }
+	if (bytes > arena->Reserved) {
+		LogE("[VirtualArena] Cannot grow '%s' arena to %lld bytes, only %lld bytes are reserved!",
+		     Memory_GetTagName(arena->Tag),
+		     bytes,
+		     arena->Reserved);
+		return FALSE;
+	}
+
+	const size_t pageSize = GetPageSize(arena);
+	size_t newCommitted   = AlignUp(bytes, pageSize);
+	if (newCommitted - arena->Committed < VIRTUAL_ARENA_COMMIT_STEP) {
+		newCommitted = AlignUp(arena->Committed + VIRTUAL_ARENA_COMMIT_STEP, pageSize);
+	}
+	if (newCommitted > arena->Reserved) { newCommitted = arena->Reserved; }
+
+	if (!Platform_VirtualCommit(arena->Base + arena->Committed, newCommitted - arena->Committed)) {
+		LogE("[VirtualArena] Failed to commit %lld bytes for '%s' arena!",
+		     newCommitted - arena->Committed,
+		     Memory_GetTagName(arena->Tag));
+		return FALSE;
+	}
+
+	atomic_fetch_add_explicit(
+		&VirtualArenaStats.CommittedBytesByTag[arena->Tag], newCommitted - arena->Committed, memory_order_relaxed);
+	arena->Committed = newCommitted;
+
+	return TRUE;
+}
+
+static B8 VirtualArena_CreateInternal(VirtualArena* arena, size_t reserveBytes, MemoryTag tag, B8 hugePages) {
+	AssertMsg(tag < MemoryTag_End, "Invalid memory tag!");
+
+	Memory_Zero(arena, sizeof(VirtualArena));
+	arena->HugePages = hugePages;
+	arena->Reserved  = AlignUp(reserveBytes, GetPageSize(arena));
+	arena->Tag       = tag;
+
+	arena->Base = hugePages ? Platform_VirtualReserveHuge(arena->Reserved) : Platform_VirtualReserve(arena->Reserved);
+	if (arena->Base == NULL) {
+		LogE("[VirtualArena] Failed to reserve %lld bytes of address space for '%s'!",
+		     arena->Reserved,
+		     Memory_GetTagName(tag));
+		return FALSE;
+	}
+
+	atomic_fetch_add_explicit(&VirtualArenaStats.ArenasByTag[tag], 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&VirtualArenaStats.ReservedBytesByTag[tag], arena->Reserved, memory_order_relaxed);
+	if (hugePages) { Memory_RegisterHugeRegion(arena->Base, arena->Reserved, tag, FALSE); }
+
+	return TRUE;
+}
+
+B8 VirtualArena_Create(VirtualArena* arena, size_t reserveBytes, MemoryTag tag) {
+	return VirtualArena_CreateInternal(arena, reserveBytes, tag, FALSE);
+}
+
+B8 VirtualArena_CreateHuge(VirtualArena* arena, size_t reserveBytes, MemoryTag tag) {
+	return VirtualArena_CreateInternal(arena, reserveBytes, tag, TRUE);
+}
+
+void VirtualArena_Destroy(VirtualArena* arena) {
+	if (arena == NULL || arena->Base == NULL) { return; }
+
+	// Copy what we need first, as the arena structure may live inside the memory we are about to release.
+	void* base             = arena->Base;
+	const size_t reserved  = arena->Reserved;
+	const size_t committed = arena->Committed;
+	const MemoryTag tag    = arena->Tag;
+
+	if (arena->HugePages) { Memory_UnregisterHugeRegion(base); }
+	Platform_VirtualRelease(base, reserved);
+
+	atomic_fetch_sub_explicit(&VirtualArenaStats.ArenasByTag[tag], 1, memory_order_relaxed);
+	atomic_fetch_sub_explicit(&VirtualArenaStats.ReservedBytesByTag[tag], reserved, memory_order_relaxed);
+	atomic_fetch_sub_explicit(&VirtualArenaStats.CommittedBytesByTag[tag], committed, memory_order_relaxed);
+}
+
+void* VirtualArena_Alloc(VirtualArena* arena, size_t size, size_t align) {
+	if (align == 0) { align = VIRTUAL_ARENA_DEFAULT_ALIGNMENT; }
+	AssertMsg((align & (align - 1)) == 0, "Arena alignment must be a power of two!");
+
+	// The base is page-aligned, so aligning the offset is enough to align the pointer.
+	const size_t offset = AlignUp(arena->Used, align);
+	if (!VirtualArena_SetUsed(arena, offset + size)) { return NULL; }
+
+	return arena->Base + offset;
+}
+
+B8 VirtualArena_SetUsed(VirtualArena* arena, size_t used) {
+	if (!VirtualArena_Commit(arena, used)) { return FALSE; }
+
+#if OBSIDIAN_DEBUG == 1
+	// Poison memory given back to the arena, to help catch it being used after release.
+	if (used < arena->Used) { Memory_Set(arena->Base + used, 0xCD, arena->Used - used); }
+#endif
+	arena->Used = used;
+
+	return TRUE;
+}
+
+void VirtualArena_Reset(VirtualArena* arena) {
+	VirtualArena_SetUsed(arena, 0);
+}
+
+void VirtualArena_Trim(VirtualArena* arena) {
+	const size_t keep = AlignUp(arena->Used, GetPageSize(arena));
+	if (keep >= arena->Committed) { return; }
+
+	Platform_VirtualDecommit(arena->Base + keep, arena->Committed - keep);
+	atomic_fetch_sub_explicit(
+		&VirtualArenaStats.CommittedBytesByTag[arena->Tag], arena->Committed - keep, memory_order_relaxed);
+	arena->Committed = keep;
+}
+
+void VirtualArena_LogUsage() {
+	for (U32 tag = 0; tag < MemoryTag_End; ++tag) {
+		const size_t arenas = atomic_load_explicit(&VirtualArenaStats.ArenasByTag[tag], memory_order_relaxed);
+		if (arenas == 0) { continue; }
+
+		LogD("[VirtualArena] - %s: %lld bytes committed of %lld reserved across %lld arenas",
+		     Memory_GetTagName(tag),
+		     atomic_load_explicit(&VirtualArenaStats.CommittedBytesByTag[tag], memory_order_relaxed),
+		     atomic_load_explicit(&VirtualArenaStats.ReservedBytesByTag[tag], memory_order_relaxed),
+		     arenas);
+	}
+}
@@ -0,0 +1,615 @@
+#define _GNU_SOURCE // Required for dladdr().
+#include <Obsidian/Platform/Platform.h>
+
+#if OBSIDIAN_LINUX == 1
+#	include <Obsidian/Containers/DynArray.h>
+#	include <Obsidian/Core/Event.h>
+#	include <Obsidian/Core/Input.h>
+#	include <Obsidian/Core/Logger.h>
+#	include <Obsidian/Core/Memory.h>
+#	include <Obsidian/Renderer/Vulkan/Common.h>
+#	include <Obsidian/Renderer/Vulkan/VulkanPlatform.h>
+#	include <X11/XKBlib.h>
+#	include <X11/Xlib.h>
+#	include <X11/Xutil.h>
+#	include <X11/keysym.h>
+#	include <dlfcn.h>
+#	include <errno.h>
+#	include <execinfo.h>
+#	include <malloc.h>
+#	include <pthread.h>
+#	include <stdatomic.h>
+#	include <stdint.h>
+#	include <stdio.h>
+#	include <stdlib.h>
+#	include <string.h>
+#	include <sys/mman.h>
+#	include <time.h>
+#	include <unistd.h>
+#	include <vulkan/vulkan_xlib.h>
+
+struct PlatformStateT {
+	Display* Display;
+	Window Window;
+	Atom WmDeleteWindow;
+	U32 FramebufferW;
+	U32 FramebufferH;
+	U32 WindowW;
+	U32 WindowH;
+	B8 Headless;
+};
+
+struct PlatformThreadT {
+	pthread_t Handle;
+	PlatformThreadFn Function;
+	void* UserData;
+};
+
+static Key TranslateKeysym(KeySym sym);
+
+B8 Platform_Initialize(PlatformState* state, const char* appName, I32 windowX, I32 windowY, I32 windowW, I32 windowH) {
+	// Allocate our state object.
+	*state = malloc(sizeof(struct PlatformStateT));
+	if (*state == NULL) {
+		Platform_ConsoleError("Failed to allocate platform state!\n");
+		return FALSE;
+	}
+	memset(*state, 0, sizeof(struct PlatformStateT));
+	(*state)->FramebufferW = windowW;
+	(*state)->FramebufferH = windowH;
+	(*state)->WindowW      = windowW;
+	(*state)->WindowH      = windowH;
+
+	// Connect to the X server.
+	(*state)->Display = XOpenDisplay(NULL);
+	if ((*state)->Display == NULL) {
+		Platform_ConsoleError("Failed to connect to the X server!\n");
+		return FALSE;
+	}
+	LogT("[Platform] Connected to X server.");
+
+	// Without this, holding a key down sends a stream of release/press pairs instead of just presses.
+	XkbSetDetectableAutoRepeat((*state)->Display, True, NULL);
+
+	// Center the window position, if applicable.
+	const int screen = DefaultScreen((*state)->Display);
+	if (windowX == -1) { windowX = (DisplayWidth((*state)->Display, screen) - windowW) / 2; }
+	if (windowY == -1) { windowY = (DisplayHeight((*state)->Display, screen) - windowH) / 2; }
+
+	// Create our initial window.
+	const long eventMask = KeyPressMask | KeyReleaseMask | ButtonPressMask | ButtonReleaseMask | PointerMotionMask |
+	                       StructureNotifyMask;
+	XSetWindowAttributes attributes = {.background_pixel = BlackPixel((*state)->Display, screen),
+	                                   .event_mask       = eventMask};
+	(*state)->Window                = XCreateWindow((*state)->Display,
+	                                                RootWindow((*state)->Display, screen),
+	                                                windowX,
+	                                                windowY,
+	                                                windowW,
+	                                                windowH,
+	                                                0,
+	                                                CopyFromParent,
+	                                                InputOutput,
+	                                                CopyFromParent,
+	                                                CWBackPixel | CWEventMask,
+	                                                &attributes);
+	if ((*state)->Window == 0) {
+		Platform_ConsoleError("Failed to create initial window!\n");
+		return FALSE;
+	}
+	XStoreName((*state)->Display, (*state)->Window, appName);
+
+	// Window managers will only tell us about the close button if we ask them to.
+	(*state)->WmDeleteWindow = XInternAtom((*state)->Display, "WM_DELETE_WINDOW", False);
+	XSetWMProtocols((*state)->Display, (*state)->Window, &(*state)->WmDeleteWindow, 1);
+
+	// Show the window. Some window managers ignore the position given at creation, so we move it again once mapped.
+	XMapWindow((*state)->Display, (*state)->Window);
+	XMoveWindow((*state)->Display, (*state)->Window, windowX, windowY);
+	XFlush((*state)->Display);
+
+	return TRUE;
+}
+
+B8 Platform_InitializeHeadless(PlatformState* state, const char* appName, U32 width, U32 height) {
+	// Allocate our state object. There is no display connection or window, only the size of our virtual framebuffer.
+	*state = malloc(sizeof(struct PlatformStateT));
+	if (*state == NULL) {
+		Platform_ConsoleError("Failed to allocate platform state!\n");
+		return FALSE;
+	}
+	memset(*state, 0, sizeof(struct PlatformStateT));
+	(*state)->FramebufferW = width;
+	(*state)->FramebufferH = height;
+	(*state)->Headless     = TRUE;
+	LogT("[Platform] Running headless with a %ux%u virtual framebuffer.", width, height);
+
+	return TRUE;
+}
+
+B8 Platform_IsHeadless(PlatformState state) {
+	return state->Headless;
+}
+
+void Platform_Shutdown(PlatformState state) {
+	if (state == NULL) { return; }
+
+	if (state->Display) {
+		if (state->Window) {
+			XDestroyWindow(state->Display, state->Window);
+			state->Window = 0;
+		}
+		XCloseDisplay(state->Display);
+		state->Display = NULL;
+	}
+
+	free(state);
+
+	Logger_Shutdown();
+}
+
+B8 Platform_Update(PlatformState state) {
+	if (state->Headless) { return TRUE; }
+
+	XEvent event;
+	while (XPending(state->Display)) {
+		XNextEvent(state->Display, &event);
+
+		switch (event.type) {
+			case ClientMessage:
+				if ((Atom) event.xclient.data.l[0] == state->WmDeleteWindow) {
+					EventContext quit = {};
+					Event_Fire(EventCode_ApplicationQuit, state, quit);
+					return FALSE;
+				}
+				break;
+			case ConfigureNotify: {
+				const U32 width  = event.xconfigure.width;
+				const U32 height = event.xconfigure.height;
+				if (width != state->FramebufferW || height != state->FramebufferH) {
+					state->FramebufferW = width;
+					state->FramebufferH = height;
+					state->WindowW      = width;
+					state->WindowH      = height;
+
+					EventContext resized = {};
+					resized.Data.U32[0]  = width;
+					resized.Data.U32[1]  = height;
+					Event_Fire(EventCode_Resized, state, resized);
+				}
+				break;
+			}
+			case KeyPress:
+			case KeyRelease: {
+				const B8 press   = event.type == KeyPress;
+				const KeySym sym = XLookupKeysym(&event.xkey, 0);
+				const Key key    = TranslateKeysym(sym);
+				if (key != 0) { Input_ProcessKey(key, press); }
+				break;
+			}
+			case ButtonPress:
+			case ButtonRelease: {
+				const B8 press = event.type == ButtonPress;
+				switch (event.xbutton.button) {
+					case Button1:
+						Input_ProcessMouseButton(MouseButton_Left, press);
+						break;
+					case Button2:
+						Input_ProcessMouseButton(MouseButton_Middle, press);
+						break;
+					case Button3:
+						Input_ProcessMouseButton(MouseButton_Right, press);
+						break;
+					// X11 reports each scroll wheel notch as a press and release of buttons 4 and 5.
+					case Button4:
+						if (press) { Input_ProcessScroll(1); }
+						break;
+					case Button5:
+						if (press) { Input_ProcessScroll(-1); }
+						break;
+				}
+				break;
+			}
+			case MotionNotify:
+				Input_ProcessMouseMove(event.xmotion.x, event.xmotion.y);
+				break;
+		}
+	}
+
+	return TRUE;
+}
+
+void Platform_GetFramebufferSize(PlatformState state, U32* width, U32* height) {
+	*width  = state->FramebufferW;
+	*height = state->FramebufferH;
+}
+
+void* Platform_Alloc(size_t bytes) {
+	return malloc(bytes);
+}
+
+void* Platform_AllocAligned(size_t bytes, size_t align) {
+	// posix_memalign requires the alignment to be at least the size of a pointer.
+	if (align < sizeof(void*)) { align = sizeof(void*); }
+
+	void* ptr = NULL;
+	if (posix_memalign(&ptr, align, bytes) != 0) { return NULL; }
+
+	return ptr;
+}
+
+void* Platform_Realloc(void* ptr, size_t bytes) {
+	if (ptr == NULL) { return Platform_Alloc(bytes); }
+
+	return realloc(ptr, bytes);
+}
+
+void* Platform_ReallocAligned(void* ptr, size_t align, size_t bytes) {
+	if (ptr == NULL) { return Platform_AllocAligned(bytes, align); }
+
+	// POSIX has no aligned equivalent of realloc. If the existing block is already big enough we can keep it, otherwise
+	// we need to allocate a new aligned block and move the data over ourselves.
+	const size_t oldBytes = malloc_usable_size(ptr);
+	if (oldBytes >= bytes) { return ptr; }
+
+	void* newPtr = Platform_AllocAligned(bytes, align);
+	if (newPtr == NULL) { return NULL; }
+	memcpy(newPtr, ptr, oldBytes);
+	free(ptr);
+
+	return newPtr;
+}
+
+void Platform_Free(void* ptr) {
+	free(ptr);
+}
+
+void Platform_FreeAligned(void* ptr) {
+	free(ptr);
+}
+
+size_t Platform_GetPageSize() {
+	// Threads may race to fill this in, but they will all store the same value.
+	static atomic_size_t cachedPageSize = 0;
+	size_t pageSize                     = atomic_load_explicit(&cachedPageSize, memory_order_relaxed);
+	if (pageSize == 0) {
+		pageSize = sysconf(_SC_PAGESIZE);
+		atomic_store_explicit(&cachedPageSize, pageSize, memory_order_relaxed);
+	}
+
+	return pageSize;
+}
+
+void* Platform_VirtualReserve(size_t bytes) {
+	// MAP_NORESERVE keeps the reservation from counting against the overcommit limit until pages are committed.
+	void* ptr = mmap(NULL, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+	return ptr == MAP_FAILED ? NULL : ptr;
+}
+
+B8 Platform_VirtualCommit(void* ptr, size_t bytes) {
+	// Pages are only backed by memory once they are first touched, so commit is just a matter of allowing access.
+	return mprotect(ptr, bytes, PROT_READ | PROT_WRITE) == 0;
+}
+
+void Platform_VirtualDecommit(void* ptr, size_t bytes) {
+	// Drop the pages, so they read back as zero if they are committed again, and forbid access until then.
+	madvise(ptr, bytes, MADV_DONTNEED);
+	mprotect(ptr, bytes, PROT_NONE);
+}
+
+void Platform_VirtualRelease(void* ptr, size_t bytes) {
+	munmap(ptr, bytes);
+}
+
+B8 Platform_VirtualProtect(void* ptr, size_t bytes, PlatformPageAccess access) {
+	static const int protections[] = {PROT_NONE, PROT_READ, PROT_READ | PROT_WRITE};
+
+	return mprotect(ptr, bytes, protections[access]) == 0;
+}
+
+size_t Platform_GetHugePageSize() {
+	// Threads may race to fill this in, but they will all store the same value.
+	static atomic_size_t cachedHugePageSize = 0;
+	size_t hugePageSize                     = atomic_load_explicit(&cachedHugePageSize, memory_order_relaxed);
+	if (hugePageSize == 0) {
+		// Default to the 2 MiB huge pages of x86-64, if the kernel doesn't tell us otherwise.
+		hugePageSize = 2 * 1024 * 1024;
+		FILE* f      = fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+		if (f) {
+			size_t size = 0;
+			if (fscanf(f, "%zu", &size) == 1 && size > 0) { hugePageSize = size; }
+			fclose(f);
+		}
+		atomic_store_explicit(&cachedHugePageSize, hugePageSize, memory_order_relaxed);
+	}
+
+	return hugePageSize;
+}
+
+/** Map a range of memory aligned to the huge page size, by over-allocating and trimming the excess. */
+static void* MapHugeAligned(size_t bytes, int prot, int flags) {
+	const size_t hugePageSize = Platform_GetHugePageSize();
+	void* raw                 = mmap(NULL, bytes + hugePageSize, prot, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+	if (raw == MAP_FAILED) { return NULL; }
+
+	void* aligned         = (void*) (((uintptr_t) raw + hugePageSize - 1) & ~(uintptr_t) (hugePageSize - 1));
+	const size_t headSize = aligned - raw;
+	const size_t tailSize = hugePageSize - headSize;
+	if (headSize > 0) { munmap(raw, headSize); }
+	if (tailSize > 0) { munmap(aligned + bytes, tailSize); }
+
+	// Transparent huge pages only apply to regions which have asked for them, unless the system enables them globally.
+	madvise(aligned, bytes, MADV_HUGEPAGE);
+
+	return aligned;
+}
+
+void* Platform_AllocHuge(size_t bytes, B8* explicitHuge) {
+	// Explicit huge pages only succeed if the system has some reserved (vm.nr_hugepages), so this will often fail.
+	void* ptr = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+	if (ptr != MAP_FAILED) {
+		*explicitHuge = TRUE;
+		return ptr;
+	}
+
+	*explicitHuge = FALSE;
+	return MapHugeAligned(bytes, PROT_READ | PROT_WRITE, 0);
+}
+
+void Platform_FreeHuge(void* ptr, size_t bytes) {
+	munmap(ptr, bytes);
+}
+
+void* Platform_VirtualReserveHuge(size_t bytes) {
+	return MapHugeAligned(bytes, PROT_NONE, MAP_NORESERVE);
+}
+
+size_t Platform_QueryHugePageBytes(const void* ptr, size_t bytes) {
+	// The kernel only reports transparent huge page usage per mapping, through /proc/self/smaps.
+	FILE* f = fopen("/proc/self/smaps", "r");
+	if (f == NULL) { return 0; }
+
+	const uintptr_t start = (uintptr_t) ptr;
+	const uintptr_t end   = start + bytes;
+	size_t overlap        = 0;
+	size_t hugeBytes      = 0;
+	char line[512];
+	while (fgets(line, sizeof(line), f)) {
+		uintptr_t mapStart, mapEnd;
+		size_t hugeKiB;
+		if (sscanf(line, "%lx-%lx ", &mapStart, &mapEnd) == 2) {
+			// A new mapping, find out how much of it lies within our range.
+			const uintptr_t overlapStart = mapStart > start ? mapStart : start;
+			const uintptr_t overlapEnd   = mapEnd < end ? mapEnd : end;
+			overlap                      = overlapEnd > overlapStart ? overlapEnd - overlapStart : 0;
+		} else if (overlap > 0 && sscanf(line, "AnonHugePages: %zu kB", &hugeKiB) == 1) {
+			// Mappings may extend beyond our range, so we can only count up to the overlapping size.
+			const size_t mappingHugeBytes = hugeKiB * 1024;
+			hugeBytes += mappingHugeBytes < overlap ? mappingHugeBytes : overlap;
+		}
+	}
+	fclose(f);
+
+	return hugeBytes;
+}
+
+void Platform_MemCopy(void* dst, const void* src, size_t bytes) {
+	memcpy(dst, src, bytes);
+}
+
+void Platform_MemMove(void* dst, const void* src, size_t bytes) {
+	memmove(dst, src, bytes);
+}
+
+void Platform_MemSet(void* ptr, U8 value, size_t bytes) {
+	memset(ptr, value, bytes);
+}
+
+void Platform_MemZero(void* ptr, size_t bytes) {
+	Platform_MemSet(ptr, 0, bytes);
+}
+
+void Platform_ConsoleOut(const char* msg) {
+	fprintf(stdout, "%s", msg);
+	fflush(stdout);
+}
+
+void Platform_ConsoleError(const char* msg) {
+	fprintf(stderr, "%s", msg);
+	fflush(stderr);
+}
+
+F64 Platform_GetAbsoluteTime() {
+	// CLOCK_MONOTONIC_RAW is not subject to NTP slewing, which keeps frame timings stable.
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+	return (F64) now.tv_sec + ((F64) now.tv_nsec * 0.000000001);
+}
+
+void Platform_Sleep(U64 ms) {
+	struct timespec remaining = {.tv_sec = ms / 1000, .tv_nsec = (ms % 1000) * 1000 * 1000};
+	// nanosleep can be interrupted by a signal, in which case it tells us how much time is left to sleep.
+	while (nanosleep(&remaining, &remaining) == -1 && errno == EINTR) {}
+}
+
+static void* ThreadEntry(void* userData) {
+	struct PlatformThreadT* thread = userData;
+	thread->Function(thread->UserData);
+	// Hand the thread's cached memory back before it exits.
+	Memory_ThreadShutdown();
+
+	return NULL;
+}
+
+PlatformThread Platform_ThreadCreate(PlatformThreadFn fn, void* userData) {
+	// pthreads pass a single pointer to the thread, so the function and its data are kept alongside the handle.
+	struct PlatformThreadT* thread = malloc(sizeof(struct PlatformThreadT));
+	if (thread == NULL) { return NULL; }
+	thread->Function = fn;
+	thread->UserData = userData;
+
+	if (pthread_create(&thread->Handle, NULL, ThreadEntry, thread) != 0) {
+		free(thread);
+		return NULL;
+	}
+
+	return thread;
+}
+
+void Platform_ThreadJoin(PlatformThread thread) {
+	pthread_join(thread->Handle, NULL);
+	free(thread);
+}
+
+U32 Platform_GetProcessorCount() {
+	const long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return count > 0 ? (U32) count : 1;
+}
+
+U32 Platform_CaptureStackTrace(void** frames, U32 maxFrames, U32 skipFrames) {
+	// backtrace() has no way to skip frames, so capture into a larger buffer. We also skip our own frame.
+	void* buffer[64];
+	U32 wanted = maxFrames + skipFrames + 1;
+	if (wanted > 64) { wanted = 64; }
+
+	const int captured = backtrace(buffer, wanted);
+	if (captured <= (int) (skipFrames + 1)) { return 0; }
+
+	const U32 count = captured - (skipFrames + 1);
+	memcpy(frames, buffer + skipFrames + 1, sizeof(void*) * count);
+
+	return count;
+}
+
+void Platform_DescribeAddress(const void* address, char* buffer, size_t bufferSize) {
+	Dl_info info;
+	if (dladdr(address, &info) == 0 || info.dli_fname == NULL) {
+		snprintf(buffer, bufferSize, "%p", address);
+	} else if (info.dli_sname) {
+		snprintf(buffer, bufferSize, "%s+0x%zx (%s)", info.dli_sname, address - info.dli_saddr, info.dli_fname);
+	} else {
+		snprintf(buffer, bufferSize, "%s+0x%zx", info.dli_fname, address - info.dli_fbase);
+	}
+}
+
+static Key TranslateKeysym(KeySym sym) {
+	// Letters and numbers share their ASCII values with the Key enum, even if they are not explicitly listed in it.
+	if (sym >= XK_a && sym <= XK_z) { return (Key) ('A' + (sym - XK_a)); }
+	if (sym >= XK_A && sym <= XK_Z) { return (Key) ('A' + (sym - XK_A)); }
+	if (sym >= XK_0 && sym <= XK_9) { return (Key) ('0' + (sym - XK_0)); }
+	if (sym >= XK_F1 && sym <= XK_F12) { return (Key) (Key_F1 + (sym - XK_F1)); }
+	if (sym >= XK_KP_0 && sym <= XK_KP_9) { return (Key) (Key_Numpad0 + (sym - XK_KP_0)); }
+
+	switch (sym) {
+		case XK_BackSpace:
+			return Key_Backspace;
+		case XK_Tab:
+			return Key_Tab;
+		case XK_Return:
+			return Key_Enter;
+		case XK_Pause:
+			return Key_Pause;
+		case XK_Caps_Lock:
+			return Key_CapsLock;
+		case XK_Escape:
+			return Key_Escape;
+		case XK_space:
+			return Key_Space;
+		case XK_Prior:
+			return Key_PageUp;
+		case XK_Next:
+			return Key_PageDown;
+		case XK_End:
+			return Key_End;
+		case XK_Home:
+			return Key_Home;
+		case XK_Left:
+			return Key_Left;
+		case XK_Up:
+			return Key_Up;
+		case XK_Right:
+			return Key_Right;
+		case XK_Down:
+			return Key_Down;
+		case XK_Print:
+			return Key_PrintScreen;
+		case XK_Insert:
+			return Key_Insert;
+		case XK_Delete:
+			return Key_Delete;
+		case XK_Super_L:
+			return Key_LeftSuper;
+		case XK_Super_R:
+			return Key_RightSuper;
+		case XK_KP_Multiply:
+			return Key_NumpadMultiply;
+		case XK_KP_Add:
+			return Key_NumpadAdd;
+		case XK_KP_Subtract:
+			return Key_NumpadSubtract;
+		case XK_KP_Decimal:
+			return Key_NumpadDecimal;
+		case XK_KP_Divide:
+			return Key_NumpadDivide;
+		case XK_Num_Lock:
+			return Key_NumLock;
+		case XK_Scroll_Lock:
+			return Key_ScrollLock;
+		case XK_Shift_L:
+			return Key_LeftShift;
+		case XK_Shift_R:
+			return Key_RightShift;
+		case XK_Control_L:
+			return Key_LeftControl;
+		case XK_Control_R:
+			return Key_RightControl;
+		case XK_Alt_L:
+			return Key_LeftAlt;
+		case XK_Alt_R:
+			return Key_RightAlt;
+		case XK_semicolon:
+			return Key_Semicolon;
+		case XK_slash:
+			return Key_Slash;
+		case XK_grave:
+			return Key_Grave;
+		case XK_bracketleft:
+			return Key_LeftBracket;
+		case XK_backslash:
+			return Key_Backslash;
+		case XK_bracketright:
+			return Key_RightBracket;
+		case XK_apostrophe:
+			return Key_Apostrophe;
+		default:
+			return 0;
+	}
+}
+
+void Platform_Vulkan_GetRequiredInstanceExtensions(DynArrayT extensionNames) {
+	DynArray_PushValue(extensionNames, &"VK_KHR_surface");
+	DynArray_PushValue(extensionNames, &"VK_KHR_xlib_surface");
+}
+
+B8 Platform_Vulkan_CreateSurface(struct PlatformStateT* platform, struct VulkanContextT* context) {
+	if (platform->Headless) { return FALSE; }
+
+	PFN_vkCreateXlibSurfaceKHR fn =
+		(PFN_vkCreateXlibSurfaceKHR) vkGetInstanceProcAddr(context->Instance, "vkCreateXlibSurfaceKHR");
+	if (!fn) { return FALSE; }
+
+	const VkXlibSurfaceCreateInfoKHR surfaceCI = {.sType  = VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR,
+	                                              .pNext  = NULL,
+	                                              .flags  = 0,
+	                                              .dpy    = platform->Display,
+	                                              .window = platform->Window};
+	VkSurfaceKHR surface                       = VK_NULL_HANDLE;
+	const VkResult createResult                = fn(context->Instance, &surfaceCI, &context->Allocator, &surface);
+	if (createResult != VK_SUCCESS) { return FALSE; }
+
+	context->Surface = surface;
+
+	return TRUE;
+}
+#endif
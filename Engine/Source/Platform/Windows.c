@@ -2,6 +2,7 @@
 
 #if OBSIDIAN_WINDOWS == 1
 #	include <Obsidian/Core/Logger.h>
+#	include <Obsidian/Core/Memory.h>
 #	include <Obsidian/Core/Input.h>
 #	include <Obsidian/Core/Event.h>
 #	include <Obsidian/Renderer/Vulkan/Common.h>
@@ -23,6 +24,13 @@ struct PlatformStateT {
 	U32 FramebufferH;
 	U32 WindowW;
 	U32 WindowH;
+	B8 Headless;
+};
+
+struct PlatformThreadT {
+	HANDLE Handle;
+	PlatformThreadFn Function;
+	void* UserData;
 };
 
 static const char* WndClassName = "ObsidianWndClass";
@@ -31,6 +39,13 @@ static LARGE_INTEGER ClockStartTime;
 
 static LRESULT CALLBACK HandleMessage(HWND hwnd, U32 msg, WPARAM wParam, LPARAM lParam);
 
+static void InitializeClock() {
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	ClockFrequency = 1.0 / (F64) frequency.QuadPart;
+	QueryPerformanceCounter(&ClockStartTime);
+}
+
 B8 Platform_Initialize(PlatformState* state, const char* appName, I32 windowX, I32 windowY, I32 windowW, I32 windowH) {
 	// Allocate our state object.
 	*state = malloc(sizeof(struct PlatformStateT));
@@ -42,10 +57,7 @@ B8 Platform_Initialize(PlatformState* state, const char* appName, I32 windowX, I
 	(*state)->Instance = GetModuleHandleA(NULL);
 
 	// Initialize our clock.
-	LARGE_INTEGER frequency;
-	QueryPerformanceFrequency(&frequency);
-	ClockFrequency = 1.0 / (F64) frequency.QuadPart;
-	QueryPerformanceCounter(&ClockStartTime);
+	InitializeClock();
 
 	// Register our main window class.
 	HICON icon           = LoadIconA((*state)->Instance, IDI_APPLICATION);
@@ -115,6 +127,26 @@ B8 Platform_Initialize(PlatformState* state, const char* appName, I32 windowX, I
 	return TRUE;
 }
 
+B8 Platform_InitializeHeadless(PlatformState* state, const char* appName, U32 width, U32 height) {
+	// Allocate our state object. There is no window, only the size of our virtual framebuffer.
+	*state = malloc(sizeof(struct PlatformStateT));
+	memset(*state, 0, sizeof(struct PlatformStateT));
+	(*state)->FramebufferW = width;
+	(*state)->FramebufferH = height;
+	(*state)->Headless     = TRUE;
+	(*state)->Instance     = GetModuleHandleA(NULL);
+
+	// Initialize our clock.
+	InitializeClock();
+	LogT("[Platform] Running headless with a %ux%u virtual framebuffer.", width, height);
+
+	return TRUE;
+}
+
+B8 Platform_IsHeadless(PlatformState state) {
+	return state->Headless;
+}
+
 void Platform_Shutdown(PlatformState state) {
 	if (state->Window) {
 		DestroyWindow(state->Window);
@@ -125,6 +157,8 @@ void Platform_Shutdown(PlatformState state) {
 }
 
 B8 Platform_Update(PlatformState state) {
+	if (state->Headless) { return TRUE; }
+
 	MSG message;
 	while (PeekMessageA(&message, NULL, 0, 0, PM_REMOVE)) {
 		if (message.message == WM_QUIT) {
@@ -149,7 +183,7 @@ void* Platform_Alloc(size_t bytes) {
 	return malloc(bytes);
 }
 
-void* Platform_AllocAligned(size_t bytes, U8 align) {
+void* Platform_AllocAligned(size_t bytes, size_t align) {
 	return _aligned_malloc(bytes, align);
 }
 
@@ -159,7 +193,7 @@ void* Platform_Realloc(void* ptr, size_t bytes) {
 	return realloc(ptr, bytes);
 }
 
-void* Platform_ReallocAligned(void* ptr, U8 align, size_t bytes) {
+void* Platform_ReallocAligned(void* ptr, size_t align, size_t bytes) {
 	if (ptr == NULL) { return Platform_AllocAligned(bytes, align); }
 
 	return _aligned_realloc(ptr, bytes, align);
@@ -173,6 +207,73 @@ void Platform_FreeAligned(void* ptr) {
 	_aligned_free(ptr);
 }
 
+size_t Platform_GetPageSize() {
+	static size_t pageSize = 0;
+	if (pageSize == 0) {
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		pageSize = info.dwPageSize;
+	}
+
+	return pageSize;
+}
+
+void* Platform_VirtualReserve(size_t bytes) {
+	return VirtualAlloc(NULL, bytes, MEM_RESERVE, PAGE_NOACCESS);
+}
+
+B8 Platform_VirtualCommit(void* ptr, size_t bytes) {
+	return VirtualAlloc(ptr, bytes, MEM_COMMIT, PAGE_READWRITE) != NULL;
+}
+
+void Platform_VirtualDecommit(void* ptr, size_t bytes) {
+	VirtualFree(ptr, bytes, MEM_DECOMMIT);
+}
+
+void Platform_VirtualRelease(void* ptr, size_t bytes) {
+	// Windows releases the whole reservation at once, and requires a size of 0.
+	VirtualFree(ptr, 0, MEM_RELEASE);
+}
+
+B8 Platform_VirtualProtect(void* ptr, size_t bytes, PlatformPageAccess access) {
+	static const DWORD protections[] = {PAGE_NOACCESS, PAGE_READONLY, PAGE_READWRITE};
+	DWORD oldProtection;
+
+	return VirtualProtect(ptr, bytes, protections[access], &oldProtection) != 0;
+}
+
+size_t Platform_GetHugePageSize() {
+	const size_t largePageSize = GetLargePageMinimum();
+
+	return largePageSize > 0 ? largePageSize : 2 * 1024 * 1024;
+}
+
+void* Platform_AllocHuge(size_t bytes, B8* explicitHuge) {
+	// Large pages require the SeLockMemoryPrivilege, so fall back to regular pages when we don't have it.
+	void* ptr = VirtualAlloc(NULL, bytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+	if (ptr) {
+		*explicitHuge = TRUE;
+		return ptr;
+	}
+
+	*explicitHuge = FALSE;
+	return VirtualAlloc(NULL, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+void Platform_FreeHuge(void* ptr, size_t bytes) {
+	VirtualFree(ptr, 0, MEM_RELEASE);
+}
+
+void* Platform_VirtualReserveHuge(size_t bytes) {
+	// Large pages cannot be committed separately from their reservation, so this is a regular reservation.
+	return VirtualAlloc(NULL, bytes, MEM_RESERVE, PAGE_NOACCESS);
+}
+
+size_t Platform_QueryHugePageBytes(const void* ptr, size_t bytes) {
+	// Windows never promotes regular pages to large pages.
+	return 0;
+}
+
 void Platform_MemCopy(void* dst, const void* src, size_t bytes) {
 	memcpy(dst, src, bytes);
 }
@@ -215,6 +316,61 @@ void Platform_Sleep(U64 ms) {
 	Sleep(ms);
 }
 
+static DWORD WINAPI ThreadEntry(LPVOID userData) {
+	struct PlatformThreadT* thread = userData;
+	thread->Function(thread->UserData);
+	// Hand the thread's cached memory back before it exits.
+	Memory_ThreadShutdown();
+
+	return 0;
+}
+
+PlatformThread Platform_ThreadCreate(PlatformThreadFn fn, void* userData) {
+	// Windows passes a single pointer to the thread, so the function and its data are kept alongside the handle.
+	struct PlatformThreadT* thread = malloc(sizeof(struct PlatformThreadT));
+	if (thread == NULL) { return NULL; }
+	thread->Function = fn;
+	thread->UserData = userData;
+
+	thread->Handle = CreateThread(NULL, 0, ThreadEntry, thread, 0, NULL);
+	if (thread->Handle == NULL) {
+		free(thread);
+		return NULL;
+	}
+
+	return thread;
+}
+
+void Platform_ThreadJoin(PlatformThread thread) {
+	WaitForSingleObject(thread->Handle, INFINITE);
+	CloseHandle(thread->Handle);
+	free(thread);
+}
+
+U32 Platform_GetProcessorCount() {
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwNumberOfProcessors > 0 ? info.dwNumberOfProcessors : 1;
+}
+
+U32 Platform_CaptureStackTrace(void** frames, U32 maxFrames, U32 skipFrames) {
+	// Skip our own frame as well.
+	return RtlCaptureStackBackTrace(skipFrames + 1, maxFrames, frames, NULL);
+}
+
+void Platform_DescribeAddress(const void* address, char* buffer, size_t bufferSize) {
+	HMODULE module = NULL;
+	char moduleName[MAX_PATH];
+	if (GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+	                       (LPCSTR) address,
+	                       &module) &&
+	    GetModuleFileNameA(module, moduleName, MAX_PATH) > 0) {
+		snprintf(buffer, bufferSize, "%s+0x%llx", moduleName, (U64) ((const char*) address - (const char*) module));
+	} else {
+		snprintf(buffer, bufferSize, "0x%p", address);
+	}
+}
+
 static LRESULT CALLBACK HandleMessage(HWND hwnd, U32 msg, WPARAM wParam, LPARAM lParam) {
 	switch (msg) {
 		case WM_MOUSEMOVE: {
@@ -277,6 +433,8 @@ void Platform_Vulkan_GetRequiredInstanceExtensions(DynArrayT extensionNames) {
 }
 
 B8 Platform_Vulkan_CreateSurface(struct PlatformStateT* platform, struct VulkanContextT* context) {
+	if (platform->Headless) { return FALSE; }
+
 	PFN_vkCreateWin32SurfaceKHR fn =
 		(PFN_vkCreateWin32SurfaceKHR) vkGetInstanceProcAddr(context->Instance, "vkCreateWin32SurfaceKHR");
 	if (!fn) { return FALSE; }
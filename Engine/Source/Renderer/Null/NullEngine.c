@@ -0,0 +1,18 @@
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Renderer/Null/NullEngine.h>
+
+B8 RenderEngine_Null_Initialize(RenderEngine engine, const char* appName, struct PlatformStateT* platform) {
+	LogD("[NullEngine] Null render engine initialized. No GPU work will be performed.");
+
+	return TRUE;
+}
+
+void RenderEngine_Null_Shutdown(RenderEngine engine) {}
+
+B8 RenderEngine_Null_BeginFrame(RenderEngine engine, F64 deltaTime) {
+	return TRUE;
+}
+
+B8 RenderEngine_Null_EndFrame(RenderEngine engine, F64 deltaTime) {
+	return TRUE;
+}
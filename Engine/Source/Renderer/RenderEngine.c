@@ -1,5 +1,6 @@
 #include <Obsidian/Core/Logger.h>
 #include <Obsidian/Core/Memory.h>
+#include <Obsidian/Renderer/Null/NullEngine.h>
 #include <Obsidian/Renderer/RenderEngine.h>
 #include <Obsidian/Renderer/Vulkan/VulkanEngine.h>
 
@@ -7,14 +8,22 @@ B8 RenderEngine_Create(RenderEngineType type, struct PlatformStateT* platform, R
 	RenderEngine ptr = Memory_Allocate(sizeof(struct RenderEngineT), MemoryTag_Renderer);
 	if (ptr == NULL) { return FALSE; }
 	Memory_Zero(ptr, sizeof(struct RenderEngineT));
+	ptr->Type = type;
 
 	switch (type) {
 		case RenderEngineType_Vulkan:
+		case RenderEngineType_VulkanHeadless:
 			ptr->Initialize = RenderEngine_Vulkan_Initialize;
 			ptr->Shutdown   = RenderEngine_Vulkan_Shutdown;
 			ptr->BeginFrame = RenderEngine_Vulkan_BeginFrame;
 			ptr->EndFrame   = RenderEngine_Vulkan_EndFrame;
 			break;
+		case RenderEngineType_Null:
+			ptr->Initialize = RenderEngine_Null_Initialize;
+			ptr->Shutdown   = RenderEngine_Null_Shutdown;
+			ptr->BeginFrame = RenderEngine_Null_BeginFrame;
+			ptr->EndFrame   = RenderEngine_Null_EndFrame;
+			break;
 		default:
 			LogE("[RenderEngine] RenderEngineType %d is invalid or not yet implemented!", type);
 			Memory_Free(ptr);
@@ -4,11 +4,8 @@
 
 static RenderEngine Engine = NULL;
 
-B8 Renderer_Initialize(const char* appName, struct PlatformStateT* platform) {
-	// TODO: Choose render engine at runtime.
-	const RenderEngineType engineType = RenderEngineType_Vulkan;
-
-	if (!RenderEngine_Create(engineType, platform, &Engine)) {
+B8 Renderer_Initialize(const char* appName, RenderEngineType type, struct PlatformStateT* platform) {
+	if (!RenderEngine_Create(type, platform, &Engine)) {
 		LogE("[Renderer] Failed to create render engine!");
 
 		return FALSE;
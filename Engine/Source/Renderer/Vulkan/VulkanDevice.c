@@ -2,6 +2,7 @@
 #include <Obsidian/Core/Logger.h>
 #include <Obsidian/Core/Memory.h>
 #include <Obsidian/Core/String.h>
+#include <Obsidian/Core/StringId.h>
 #include <Obsidian/Renderer/Vulkan/VulkanDevice.h>
 #include <Obsidian/Renderer/Vulkan/VulkanStrings.h>
 
@@ -97,20 +98,32 @@ static B8 VulkanDevice_CheckCompatibility(VulkanContext* context, const Physical
 	const U32 familyCount = DynArray_Size(&info->QueueFamilies);
 	for (U32 i = 0; i < familyCount; ++i) {
 		if (info->QueueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
-			graphicsQueue    = TRUE;
-			VkBool32 present = VK_FALSE;
-			context->vk.GetPhysicalDeviceSurfaceSupportKHR(info->GPU, i, context->Surface, &present);
-			if (present == VK_TRUE) { presentQueue = TRUE; }
+			graphicsQueue = TRUE;
+			// Without a surface there is nothing to present to, so any graphics queue will do.
+			if (context->Headless) {
+				presentQueue = TRUE;
+			} else {
+				VkBool32 present = VK_FALSE;
+				context->vk.GetPhysicalDeviceSurfaceSupportKHR(info->GPU, i, context->Surface, &present);
+				if (present == VK_TRUE) { presentQueue = TRUE; }
+			}
 		}
 		if (info->QueueFamilies[i].queueFlags & VK_QUEUE_TRANSFER_BIT) { transferQueue = TRUE; }
 		if (info->QueueFamilies[i].queueFlags & VK_QUEUE_COMPUTE_BIT) { computeQueue = TRUE; }
 	}
 	if (!graphicsQueue || !transferQueue || !computeQueue || !presentQueue) { return FALSE; }
 
+	if (context->Headless) { return TRUE; }
+
 	B8 extSwapchain          = FALSE;
 	const U32 extensionCount = DynArray_Size(&info->Extensions);
 	for (U32 i = 0; i < extensionCount; ++i) {
-		if (String_Equal(info->Extensions[i].extensionName, VK_KHR_SWAPCHAIN_EXTENSION_NAME)) { extSwapchain = TRUE; }
+		// Names are compared by ID first, and only compared in full to rule out a hash collision.
+		const char* name = info->Extensions[i].extensionName;
+		if (StringId_FromString(name) == StringId_Literal(VK_KHR_SWAPCHAIN_EXTENSION_NAME) &&
+		    String_Equal(name, VK_KHR_SWAPCHAIN_EXTENSION_NAME)) {
+			extSwapchain = TRUE;
+		}
 	}
 	if (!extSwapchain) { return FALSE; }
 
@@ -194,10 +207,13 @@ VkResult VulkanDevice_Create(VulkanContext* context) {
 		return VK_ERROR_INCOMPATIBLE_DRIVER;
 	}
 
+	// Everything we build to describe the device is thrown away once it's created, so it all lives on scratch memory.
+	const MemoryScratch scratch = Memory_ScratchBegin();
+
 	// Determine our queue assignments
 	const U32 familyCount = DynArray_Size(&context->DeviceInfo.QueueFamilies);
 	// Keep track of how many queues we have in each family, so we don't double-assign any.
-	U32* queueCounts = DynArray_CreateWithSize(U32, familyCount);
+	U32* queueCounts = DynArray_CreateScratchWithSize(U32, familyCount);
 
 	// Main graphics queue
 	{
@@ -312,7 +328,7 @@ VkResult VulkanDevice_Create(VulkanContext* context) {
 		     context->DeviceInfo.AsyncGraphicsFamily,
 		     context->DeviceInfo.AsyncGraphicsIndex);
 
-		uniqueFamilies = DynArray_CreateWithCapacity(U32, familyCount);
+		uniqueFamilies = DynArray_CreateScratch(U32, familyCount);
 		U32 maxCount   = 0;
 		for (U32 i = 0; i < familyCount; ++i) {
 			if (queueCounts[i] > 0) {
@@ -321,9 +337,9 @@ VkResult VulkanDevice_Create(VulkanContext* context) {
 			}
 			if (queueCounts[i] > maxCount) { maxCount = queueCounts[i]; }
 		}
-		queuePriorities = DynArray_CreateWithSize(F32, maxCount);
+		queuePriorities = DynArray_CreateScratchWithSize(F32, maxCount);
 		for (U32 i = 0; i < maxCount; ++i) { queuePriorities[i] = 1.0f; }
-		queueCIs = DynArray_CreateWithSize(VkDeviceQueueCreateInfo, uniqueFamilyCount);
+		queueCIs = DynArray_CreateScratchWithSize(VkDeviceQueueCreateInfo, uniqueFamilyCount);
 		for (U32 i = 0; i < uniqueFamilyCount; ++i) {
 			queueCIs[i].sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
 			queueCIs[i].pNext            = NULL;
@@ -336,10 +352,10 @@ VkResult VulkanDevice_Create(VulkanContext* context) {
 
 	// Extensions
 	U32 enabledExtensionCount      = 0;
-	const char** enabledExtensions = DynArray_Create(const char*);
+	const char** enabledExtensions = DynArray_CreateScratch(const char*, DynArray_DefaultCapacity);
 	{
 		// We check for VK_KHR_swapchain in device compatibility, so there is no need to check for it here.
-		DynArray_PushValue(&enabledExtensions, &VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+		if (!context->Headless) { DynArray_PushValue(&enabledExtensions, &VK_KHR_SWAPCHAIN_EXTENSION_NAME); }
 
 		enabledExtensionCount = DynArray_Size(&enabledExtensions);
 	}
@@ -364,11 +380,7 @@ VkResult VulkanDevice_Create(VulkanContext* context) {
 	const VkResult deviceResult =
 		context->vk.CreateDevice(context->PhysicalDevice, &deviceCI, &context->Allocator, &device);
 
-	DynArray_Destroy(&enabledExtensions);
-	DynArray_Destroy(&uniqueFamilies);
-	DynArray_Destroy(&queuePriorities);
-	DynArray_Destroy(&queueCIs);
-	DynArray_Destroy(&queueCounts);
+	Memory_ScratchEnd(scratch);
 
 	if (deviceResult == VK_SUCCESS) {
 		context->Device = device;
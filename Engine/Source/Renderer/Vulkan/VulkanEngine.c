@@ -1,6 +1,7 @@
 #include <Obsidian/Containers/DynArray.h>
 #include <Obsidian/Core/Logger.h>
 #include <Obsidian/Core/Memory.h>
+#include <Obsidian/Platform/Platform.h>
 #include <Obsidian/Renderer/Vulkan/Common.h>
 #include <Obsidian/Renderer/Vulkan/VulkanDebug.h>
 #include <Obsidian/Renderer/Vulkan/VulkanDevice.h>
@@ -14,6 +15,13 @@
 static VulkanContext Vulkan;
 
 static void* Vulkan_Allocate(void* pUserData, size_t size, size_t alignment, VkSystemAllocationScope scope) {
+	// Only long-lived driver allocations large enough to fill a huge page are worth backing with huge pages. Short-lived
+	// command and object allocations go to the regular heap.
+	const B8 longLived = scope == VK_SYSTEM_ALLOCATION_SCOPE_DEVICE || scope == VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE;
+	if (longLived && size >= Platform_GetHugePageSize()) {
+		return Memory_AllocateHuge(size, alignment, MemoryTag_Renderer);
+	}
+
 	return Memory_AllocateAligned(size, alignment, MemoryTag_Renderer);
 }
 
@@ -56,6 +64,7 @@ static B8 Vulkan_LoadGlobalFunctions() {
 B8 RenderEngine_Vulkan_Initialize(RenderEngine engine, const char* appName, struct PlatformStateT* platform) {
 	Memory_Zero(&Vulkan, sizeof(struct VulkanContextT));
 	Vulkan.Platform = platform;
+	Vulkan.Headless = engine->Type == RenderEngineType_VulkanHeadless;
 
 	// Set up allocator callbacks
 	{
@@ -74,9 +83,9 @@ B8 RenderEngine_Vulkan_Initialize(RenderEngine engine, const char* appName, stru
 
 	// Create instance
 	{
-		// Gather required instance extensions
+		// Gather required instance extensions. Headless rendering never presents, so it needs no surface extensions.
 		const char** instanceExtensions = DynArray_Create(const char*);
-		Platform_Vulkan_GetRequiredInstanceExtensions((DynArrayT) &instanceExtensions);
+		if (!Vulkan.Headless) { Platform_Vulkan_GetRequiredInstanceExtensions((DynArrayT) &instanceExtensions); }
 
 		const VkResult instanceResult = VulkanInstance_Create(&Vulkan, (ConstDynArrayT) &instanceExtensions);
 
@@ -99,7 +108,7 @@ B8 RenderEngine_Vulkan_Initialize(RenderEngine engine, const char* appName, stru
 	}
 
 	// Create platform surface
-	{
+	if (!Vulkan.Headless) {
 		const B8 surfaceCreated = Platform_Vulkan_CreateSurface(platform, &Vulkan);
 		if (!surfaceCreated) {
 			LogE("[Vulkan] Failed to create Vulkan surface!");
@@ -121,7 +130,7 @@ B8 RenderEngine_Vulkan_Initialize(RenderEngine engine, const char* appName, stru
 		}
 	}
 
-	// Create swapchain
+	// Create swapchain, or our offscreen render targets when running headless
 	{
 		const VkResult swapchainResult = VulkanSwapchain_Create(&Vulkan);
 		if (swapchainResult != VK_SUCCESS) {
@@ -1,7 +1,9 @@
+#include <Obsidian/Containers/Dictionary.h>
 #include <Obsidian/Containers/DynArray.h>
 #include <Obsidian/Core/Logger.h>
 #include <Obsidian/Core/Memory.h>
 #include <Obsidian/Core/String.h>
+#include <Obsidian/Core/StringId.h>
 #include <Obsidian/Renderer/Vulkan/VulkanDebug.h>
 #include <Obsidian/Renderer/Vulkan/VulkanInstance.h>
 
@@ -29,14 +31,16 @@ static B8 ListContains(ConstDynArrayT listArray, const char* entry) {
 /**
  * Determine of the specified layer is within the given list.
  * @param listArray A VkLayerProperties DynArray of available layers.
- * @param layer The layer to search for.
+ * @param layer The name of the layer.
+ * @param layerId The ID of the layer's name.
  * @return TRUE if the layer was found, FALSE otherwise.
  */
-static B8 FindLayer(ConstDynArrayT listArray, const char* layer) {
+static B8 FindLayer(ConstDynArrayT listArray, const char* layer, StringId layerId) {
 	const VkLayerProperties* const list = *listArray;
 	const U64 layerCount                = DynArray_Size(listArray);
 	for (U64 i = 0; i < layerCount; ++i) {
-		if (String_Equal(list[i].layerName, layer)) { return TRUE; }
+		// Names are compared by ID first, and only compared in full to rule out a hash collision.
+		if (StringId_FromString(list[i].layerName) == layerId && String_Equal(list[i].layerName, layer)) { return TRUE; }
 	}
 
 	return FALSE;
@@ -44,39 +48,38 @@ static B8 FindLayer(ConstDynArrayT listArray, const char* layer) {
 
 /**
  * Determine if an extension is available and what layer is required to enable it.
- * @param listArray A VulkanInstanceExtension DynArray of Vulkan extensions and their source layers.
- * @param extension The extension name to find.
+ * @param extensionLookup A Dictionary mapping the name IDs of Vulkan extensions to their VulkanInstanceExtension.
+ * @param extension The name of the extension to find.
+ * @param extensionId The ID of the extension's name.
  * @param[out] requiredLayer A pointer to layer properties that will represent what layer is needed to enable the
  * extension.
  * @return TRUE is the extension is found and available, FALSE otherwise.
  */
-static B8 FindExtension(ConstDynArrayT listArray, const char* extension, VkLayerProperties** requiredLayer) {
-	const VulkanInstanceExtension* const list = *listArray;
-	const U64 extensionCount                  = DynArray_Size(listArray);
-	for (U64 i = 0; i < extensionCount; ++i) {
-		if (String_Equal(list[i].Extension.extensionName, extension)) {
-			if (requiredLayer) { *requiredLayer = list[i].Layer; }
-			return TRUE;
-		}
-	}
+static B8 FindExtension(ConstDictionaryT extensionLookup,
+                        const char* extension,
+                        StringId extensionId,
+                        VkLayerProperties** requiredLayer) {
+	const VulkanInstanceExtension* const* ext = Dictionary_FindInt(extensionLookup, extensionId);
+	if (ext == NULL || !String_Equal((*ext)->Extension.extensionName, extension)) { return FALSE; }
 
-	return FALSE;
+	if (requiredLayer) { *requiredLayer = (*ext)->Layer; }
+
+	return TRUE;
 }
 
 /**
  * Enable the specified extension.
  * @param extension The extension to enable.
- * @param availableExtension A VulkanInstanceExtension DynArray containing all available extensions and their required
- * layers.
+ * @param extensionLookup A Dictionary mapping the name IDs of available extensions to their VulkanInstanceExtension.
  * @param enabledExtensions A const char* DynArray to append the extension to.
  * @param enabledLayers A const char* DynArray to append any required layers to.
  */
 static void EnableExtension(const char* extension,
-                            ConstDynArrayT availableExtensionsArray,
+                            ConstDictionaryT extensionLookup,
                             DynArrayT enabledExtensionsArray,
                             DynArrayT enabledLayersArray) {
 	VkLayerProperties* layer = NULL;
-	if (FindExtension(availableExtensionsArray, extension, &layer)) {
+	if (FindExtension(extensionLookup, extension, StringId_FromString(extension), &layer)) {
 		// We found the extension, enable it
 		DynArray_Push(enabledExtensionsArray, extension);
 		// If the extension has a required layer, enable it too
@@ -113,37 +116,40 @@ VkResult VulkanInstance_Create(VulkanContext* context, ConstDynArrayT instanceEx
 	}
 
 	// Enumerate instance extensions
-	U32 availableExtensionCount                  = 0;
-	VulkanInstanceExtension* availableExtensions = NULL;
+	U32 availableExtensionCount                     = 0;
+	VulkanInstanceExtension* availableExtensions    = NULL;
+	const VulkanInstanceExtension** extensionLookup = NULL;
 	{
-		// First enumerate all core extensions
-		U32 coreExtensionCount = 0;
-		context->vk.EnumerateInstanceExtensionProperties(NULL, &coreExtensionCount, NULL);
-		VkExtensionProperties* extensions = DynArray_CreateWithSize(VkExtensionProperties, coreExtensionCount);
-		context->vk.EnumerateInstanceExtensionProperties(NULL, &coreExtensionCount, extensions);
-		// Copy core extensions into our array
-		availableExtensions = DynArray_CreateWithCapacity(VulkanInstanceExtension, coreExtensionCount);
-		for (U32 i = 0; i < coreExtensionCount; ++i) {
-			VulkanInstanceExtension ext = {.Extension = extensions[i], .Layer = NULL};
-			DynArray_Push(&availableExtensions, ext);
-		}
-		availableExtensionCount = coreExtensionCount;
-
-		// Next, enumerate the extensions from all of our layers
+		// First count the core extensions and those of all of our layers. Our array is made large enough for all of
+		// them, so it never moves and the lookup can refer to the entries stored within it.
+		U32 totalExtensionCount = 0;
+		context->vk.EnumerateInstanceExtensionProperties(NULL, &totalExtensionCount, NULL);
 		for (U32 layerIndex = 0; layerIndex < availableLayerCount; ++layerIndex) {
-			const VkLayerProperties* layer = &availableLayers[layerIndex];
-			U32 layerExtensionCount        = 0;
-			context->vk.EnumerateInstanceExtensionProperties(layer->layerName, &layerExtensionCount, NULL);
-			DynArray_Resize(&extensions, layerExtensionCount);
-			context->vk.EnumerateInstanceExtensionProperties(layer->layerName, &layerExtensionCount, extensions);
-
-			// Copy layer extensions into our array, if they don't already exist.
-			for (U32 i = 0; i < layerExtensionCount; ++i) {
-				if (!FindExtension((ConstDynArrayT) &availableExtensions, extensions[i].extensionName, NULL)) {
-					availableExtensionCount++;
-					VulkanInstanceExtension ext = {.Extension = extensions[i], .Layer = &availableLayers[layerIndex]};
-					DynArray_Push(&availableExtensions, ext);
-				}
+			U32 layerExtensionCount = 0;
+			context->vk.EnumerateInstanceExtensionProperties(
+				availableLayers[layerIndex].layerName, &layerExtensionCount, NULL);
+			totalExtensionCount += layerExtensionCount;
+		}
+		VkExtensionProperties* extensions = DynArray_CreateWithSize(VkExtensionProperties, totalExtensionCount);
+		availableExtensions = DynArray_CreateWithCapacity(VulkanInstanceExtension, totalExtensionCount);
+		extensionLookup     = Dictionary_CreateIntWithCapacity(const VulkanInstanceExtension*, totalExtensionCount);
+
+		// Enumerate the core extensions, then the extensions from all of our layers. Each call may only fill the space we
+		// have left, in case the counts have changed since.
+		for (I64 layerIndex = -1; layerIndex < (I64) availableLayerCount; ++layerIndex) {
+			VkLayerProperties* layer = layerIndex >= 0 ? &availableLayers[layerIndex] : NULL;
+			U32 extensionCount       = totalExtensionCount - availableExtensionCount;
+			context->vk.EnumerateInstanceExtensionProperties(layer ? layer->layerName : NULL, &extensionCount, extensions);
+
+			// Copy extensions into our array, if they don't already exist.
+			for (U32 i = 0; i < extensionCount; ++i) {
+				const char* name      = extensions[i].extensionName;
+				const StringId nameId = StringId_FromString(name);
+				if (FindExtension((ConstDictionaryT) &extensionLookup, name, nameId, NULL)) { continue; }
+				VulkanInstanceExtension ext = {.Extension = extensions[i], .Layer = layer};
+				DynArray_Push(&availableExtensions, ext);
+				const VulkanInstanceExtension* added = &availableExtensions[availableExtensionCount++];
+				Dictionary_InsertInt(&extensionLookup, nameId, added);
 			}
 		}
 
@@ -164,18 +170,20 @@ VkResult VulkanInstance_Create(VulkanContext* context, ConstDynArrayT instanceEx
 		}
 	}
 
-	// By default, we don't enable any layers
-	const char** enabledLayers = DynArray_Create(const char*);
+	// By default, we don't enable any layers. Only a few are ever enabled, so the list starts out on the stack.
+	DynArray_InlineStorage(const char*, 4) enabledLayerStorage;
+	const char** enabledLayers = DynArray_CreateInline(const char*, enabledLayerStorage);
 
 	// Gather a list of all enabled extensions
 	// Starting with the required extensions from the arguments
 	U64 requiredExtensionCount = 0;
 	if (instanceExtensionsArray) { requiredExtensionCount = DynArray_Size(instanceExtensionsArray); }
+	DynArray_InlineStorage(const char*, 16) enabledExtensionStorage;
 	const char* const* instanceExtensions = *instanceExtensionsArray;
-	const char** enabledExtensions        = DynArray_CreateWithCapacity(const char*, requiredExtensionCount);
+	const char** enabledExtensions        = DynArray_CreateInline(const char*, enabledExtensionStorage);
 	for (U32 i = 0; i < requiredExtensionCount; ++i) {
 		EnableExtension(instanceExtensions[i],
-		                (ConstDynArrayT) &availableExtensions,
+		                (ConstDictionaryT) &extensionLookup,
 		                (DynArrayT) &enabledExtensions,
 		                (DynArrayT) &enabledLayers);
 	}
@@ -184,15 +192,17 @@ VkResult VulkanInstance_Create(VulkanContext* context, ConstDynArrayT instanceEx
 #if OBSIDIAN_DEBUG == 1
 	B8 enableValidation = TRUE;
 	// First ensure that the required layers and extensions are available
-	if (!FindLayer((ConstDynArrayT) &availableLayers, "VK_LAYER_KHRONOS_validation")) { enableValidation = FALSE; }
-	if (!FindExtension((ConstDynArrayT) &availableExtensions, VK_EXT_DEBUG_UTILS_EXTENSION_NAME, NULL)) {
-		enableValidation = FALSE;
-	}
+	const char* validationLayer      = "VK_LAYER_KHRONOS_validation";
+	const StringId validationLayerId = StringId_Literal("VK_LAYER_KHRONOS_validation");
+	const char* debugUtils           = VK_EXT_DEBUG_UTILS_EXTENSION_NAME;
+	const StringId debugUtilsId      = StringId_Literal(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+	if (!FindLayer((ConstDynArrayT) &availableLayers, validationLayer, validationLayerId)) { enableValidation = FALSE; }
+	if (!FindExtension((ConstDictionaryT) &extensionLookup, debugUtils, debugUtilsId, NULL)) { enableValidation = FALSE; }
 	// If everything is in order, add the required extensions and layers to enabled
 	if (enableValidation) {
 		DynArray_PushValue(&enabledLayers, &"VK_LAYER_KHRONOS_validation");
 		EnableExtension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
-		                (ConstDynArrayT) &availableExtensions,
+		                (ConstDictionaryT) &extensionLookup,
 		                (DynArrayT) &enabledExtensions,
 		                (DynArrayT) &enabledLayers);
 	} else {
@@ -222,7 +232,8 @@ VkResult VulkanInstance_Create(VulkanContext* context, ConstDynArrayT instanceEx
 	B8 extensionsPresent   = TRUE;
 	const U64 enabledCount = DynArray_Size(&enabledExtensions);
 	for (U32 i = 0; i < enabledCount; ++i) {
-		if (!FindExtension((ConstDynArrayT) &availableExtensions, enabledExtensions[i], NULL)) {
+		const StringId extensionId = StringId_FromString(enabledExtensions[i]);
+		if (!FindExtension((ConstDictionaryT) &extensionLookup, enabledExtensions[i], extensionId, NULL)) {
 			LogE("[VulkanInstance] Missing required instance extension '%s'!", instanceExtensions[i]);
 			extensionsPresent = FALSE;
 			createResult      = VK_ERROR_EXTENSION_NOT_PRESENT;
@@ -261,6 +272,7 @@ VkResult VulkanInstance_Create(VulkanContext* context, ConstDynArrayT instanceEx
 	// Cleanup
 	DynArray_Destroy(&enabledExtensions);
 	DynArray_Destroy(&enabledLayers);
+	Dictionary_Destroy(&extensionLookup);
 	DynArray_Destroy(&availableExtensions);
 	DynArray_Destroy(&availableLayers);
 
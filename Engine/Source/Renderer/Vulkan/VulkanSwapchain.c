@@ -17,7 +17,11 @@ VkResult VulkanSwapchain_Create(VulkanContext* context) {
 		return result;
 	}
 
-	LogD("[Vulkan] Swapchain created.");
+	if (context->Headless) {
+		LogD("[Vulkan] Offscreen render targets created.");
+	} else {
+		LogD("[Vulkan] Swapchain created.");
+	}
 
 	return VK_SUCCESS;
 }
@@ -37,6 +41,11 @@ void VulkanSwapchain_Clean(VulkanContext* context) {
 		context->Swapchain.Views = NULL;
 	}
 	if (context->Swapchain.Images) {
+		// Swapchain images are owned by the swapchain, but offscreen images have memory we allocated ourselves.
+		const U32 imageCount = DynArray_Size(&context->Swapchain.Images);
+		for (U32 i = 0; i < imageCount; ++i) {
+			if (context->Swapchain.Images[i].Memory) { VulkanImage_Destroy(context, &context->Swapchain.Images[i]); }
+		}
 		DynArray_Destroy(&context->Swapchain.Images);
 		context->Swapchain.Images = NULL;
 	}
@@ -58,7 +67,115 @@ void VulkanSwapchain_Destroy(VulkanContext* context) {
 	}
 }
 
+/** Create the depth image and view that accompany our color images. */
+static VkResult VulkanSwapchain_CreateDepth(VulkanContext* context, VkExtent3D extent) {
+	// Determine our favorite depth format
+	VkFormat depthFormat          = VK_FORMAT_UNDEFINED;
+	const VkFormat depthFormats[] = {VK_FORMAT_D32_SFLOAT,
+	                                 VK_FORMAT_D32_SFLOAT_S8_UINT,
+	                                 VK_FORMAT_D24_UNORM_S8_UINT,
+	                                 VK_FORMAT_D16_UNORM,
+	                                 VK_FORMAT_D16_UNORM_S8_UINT};
+	const U32 depthFormatCount    = sizeof(depthFormats) / sizeof(*depthFormats);
+	for (U32 i = 0; i < depthFormatCount; ++i) {
+		VkFormatProperties props;
+		context->vk.GetPhysicalDeviceFormatProperties(context->PhysicalDevice, depthFormats[i], &props);
+		if (props.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT) {
+			depthFormat = depthFormats[i];
+			break;
+		}
+	}
+	// Per Vulkan spec, at least one of the above formats MUST be supported, so this should never happen
+	Assert(depthFormat != VK_FORMAT_UNDEFINED);
+
+	// Create our depth image
+	const VulkanImage_CreateInfo depthCI = {.Type   = VK_IMAGE_TYPE_2D,
+	                                        .Format = depthFormat,
+	                                        .Extent = extent,
+	                                        .Usage  = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT};
+	const VkResult imageResult           = VulkanImage_Create(context, &depthCI, &context->Swapchain.DepthImage);
+	if (imageResult != VK_SUCCESS) {
+		LogE("[VulkanSwapchain] Failed to create depth image for swapchain! (%s)", VulkanString_VkResult(imageResult));
+
+		return imageResult;
+	}
+	const VulkanImageView_CreateInfo depthViewCI = {.Image          = &context->Swapchain.DepthImage,
+	                                                .Type           = VK_IMAGE_VIEW_TYPE_2D,
+	                                                .Format         = depthCI.Format,
+	                                                .BaseMipLevel   = 0,
+	                                                .MipLevels      = 1,
+	                                                .BaseArrayLayer = 0,
+	                                                .ArrayLayers    = 1};
+	const VkResult viewResult = VulkanImageView_Create(context, &depthViewCI, &context->Swapchain.DepthView);
+	if (viewResult != VK_SUCCESS) {
+		LogE("[VulkanSwapchain] Failed to create depth image view for swapchain! (%s)", VulkanString_VkResult(viewResult));
+
+		return viewResult;
+	}
+
+	return VK_SUCCESS;
+}
+
+/** Create our own color images to render into when there is no surface to present to. */
+static VkResult VulkanSwapchain_RecreateOffscreen(VulkanContext* context) {
+	// Offscreen images are not tied to a surface, so there's nothing to preserve from the old set.
+	VulkanSwapchain_Clean(context);
+
+	const U32 imageCount = 2;
+	VkExtent3D extent    = {.width = 0, .height = 0, .depth = 1};
+	Platform_GetFramebufferSize(context->Platform, &extent.width, &extent.height);
+
+	LogT("[VulkanSwapchain] Offscreen parameters:");
+	LogT("[VulkanSwapchain] - Images: %u", imageCount);
+	LogT("[VulkanSwapchain] - Format: %s", VulkanString_VkFormat(VK_FORMAT_B8G8R8A8_SRGB));
+	LogT("[VulkanSwapchain] - Extent: %u x %u", extent.width, extent.height);
+
+	const VulkanImage_CreateInfo imageCI = {.Type   = VK_IMAGE_TYPE_2D,
+	                                        .Format = VK_FORMAT_B8G8R8A8_SRGB,
+	                                        .Extent = extent,
+	                                        .Usage  = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT};
+	VulkanImageView_CreateInfo viewCI    = {.Image          = NULL,  // To be filled in for loop
+	                                        .Type           = VK_IMAGE_VIEW_TYPE_2D,
+	                                        .Format         = imageCI.Format,
+	                                        .BaseMipLevel   = 0,
+	                                        .MipLevels      = 1,
+	                                        .BaseArrayLayer = 0,
+	                                        .ArrayLayers    = 1};
+
+	context->Swapchain.Images = DynArray_CreateWithSize(VulkanImage, imageCount);
+	context->Swapchain.Views  = DynArray_CreateWithSize(VulkanImageView, imageCount);
+	for (U32 i = 0; i < imageCount; ++i) {
+		const VkResult imageResult = VulkanImage_Create(context, &imageCI, &context->Swapchain.Images[i]);
+		if (imageResult != VK_SUCCESS) {
+			LogE("[VulkanSwapchain] Failed to create offscreen image! (%s)", VulkanString_VkResult(imageResult));
+			VulkanSwapchain_Destroy(context);
+
+			return imageResult;
+		}
+
+		viewCI.Image              = &context->Swapchain.Images[i];
+		const VkResult viewResult = VulkanImageView_Create(context, &viewCI, &context->Swapchain.Views[i]);
+		if (viewResult != VK_SUCCESS) {
+			LogE("[VulkanSwapchain] Failed to create image view for offscreen image!");
+			VulkanSwapchain_Destroy(context);
+
+			return viewResult;
+		}
+	}
+
+	const VkResult depthResult = VulkanSwapchain_CreateDepth(context, extent);
+	if (depthResult != VK_SUCCESS) {
+		VulkanSwapchain_Destroy(context);
+
+		return depthResult;
+	}
+
+	return VK_SUCCESS;
+}
+
 VkResult VulkanSwapchain_Recreate(VulkanContext* context) {
+	if (context->Headless) { return VulkanSwapchain_RecreateOffscreen(context); }
+
 	// First update all of our surface capability information.
 	{
 		context->vk.GetPhysicalDeviceSurfaceCapabilitiesKHR(
@@ -216,50 +333,12 @@ VkResult VulkanSwapchain_Recreate(VulkanContext* context) {
 		}
 	}
 
-	// Determine our favorite depth format
-	VkFormat depthFormat          = VK_FORMAT_UNDEFINED;
-	const VkFormat depthFormats[] = {VK_FORMAT_D32_SFLOAT,
-	                                 VK_FORMAT_D32_SFLOAT_S8_UINT,
-	                                 VK_FORMAT_D24_UNORM_S8_UINT,
-	                                 VK_FORMAT_D16_UNORM,
-	                                 VK_FORMAT_D16_UNORM_S8_UINT};
-	const U32 depthFormatCount    = sizeof(depthFormats) / sizeof(*depthFormats);
-	for (U32 i = 0; i < depthFormatCount; ++i) {
-		VkFormatProperties props;
-		context->vk.GetPhysicalDeviceFormatProperties(context->PhysicalDevice, depthFormats[i], &props);
-		if (props.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT) {
-			depthFormat = depthFormats[i];
-			break;
-		}
-	}
-	// Per Vulkan spec, at least one of the above formats MUST be supported, so this should never happen
-	Assert(depthFormat != VK_FORMAT_UNDEFINED);
-
-	// Create our depth image
-	const VulkanImage_CreateInfo depthCI = {.Type   = VK_IMAGE_TYPE_2D,
-	                                        .Format = depthFormat,
-	                                        .Extent = imageCI.extent,
-	                                        .Usage  = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT};
-	const VkResult imageResult           = VulkanImage_Create(context, &depthCI, &context->Swapchain.DepthImage);
-	if (imageResult != VK_SUCCESS) {
-		LogE("[VulkanSwapchain] Failed to create depth image for swapchain! (%s)", VulkanString_VkResult(imageResult));
+	// Create our depth buffer
+	const VkResult depthResult = VulkanSwapchain_CreateDepth(context, imageCI.extent);
+	if (depthResult != VK_SUCCESS) {
 		VulkanSwapchain_Destroy(context);
 
-		return imageResult;
-	}
-	const VulkanImageView_CreateInfo depthViewCI = {.Image          = &context->Swapchain.DepthImage,
-	                                                .Type           = VK_IMAGE_VIEW_TYPE_2D,
-	                                                .Format         = depthCI.Format,
-	                                                .BaseMipLevel   = 0,
-	                                                .MipLevels      = 1,
-	                                                .BaseArrayLayer = 0,
-	                                                .ArrayLayers    = 1};
-	const VkResult viewResult = VulkanImageView_Create(context, &depthViewCI, &context->Swapchain.DepthView);
-	if (viewResult != VK_SUCCESS) {
-		LogE("[VulkanSwapchain] Failed to create depth image view for swapchain! (%s)", VulkanString_VkResult(viewResult));
-		VulkanSwapchain_Destroy(context);
-
-		return viewResult;
+		return depthResult;
 	}
 
 	return VK_SUCCESS;
@@ -58,6 +58,7 @@ B8 GetApplicationInfo(ApplicationCreateInfo* createInfo) {
 	createInfo->Callbacks.Shutdown   = Game_Shutdown;
 	createInfo->Callbacks.OnResized  = Game_OnResized;
 	createInfo->UserData             = NULL;
+	createInfo->RenderEngine         = RenderEngineType_Vulkan;
 
 	return TRUE;
 }
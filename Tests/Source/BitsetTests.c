@@ -0,0 +1,81 @@
+#include <Obsidian/Containers/Bitset.h>
+
+#include "Test.h"
+
+static void TestBits() {
+	Bitset bits;
+	Test_Check(Bitset_Create(&bits, 130));
+	Test_Check(Bitset_Count(&bits) == 0);
+
+	Bitset_Set(&bits, 0);
+	Bitset_Set(&bits, 63);
+	Bitset_Set(&bits, 64);
+	Bitset_Set(&bits, 129);
+	Bitset_Assign(&bits, 100, TRUE);
+	Bitset_Assign(&bits, 64, FALSE);
+	Test_Check(Bitset_Test(&bits, 0) && Bitset_Test(&bits, 63) && Bitset_Test(&bits, 100) && Bitset_Test(&bits, 129));
+	Test_Check(!Bitset_Test(&bits, 1) && !Bitset_Test(&bits, 64) && !Bitset_Test(&bits, 128));
+	Test_Check(Bitset_Count(&bits) == 4);
+
+	// Iteration visits the set bits in order.
+	const U64 expected[] = {0, 63, 100, 129};
+	U64 found            = 0;
+	for (U64 i = Bitset_Next(&bits, 0); i < bits.BitCount; i = Bitset_Next(&bits, i + 1)) {
+		Test_Check(found < 4 && i == expected[found]);
+		found++;
+	}
+	Test_Check(found == 4);
+
+	Bitset_Clear(&bits, 63);
+	Test_Check(!Bitset_Test(&bits, 63));
+
+	// Filling must not set the bits past the end of the set.
+	Bitset_Fill(&bits, TRUE);
+	Test_Check(Bitset_Count(&bits) == 130);
+	Test_Check(Bitset_Next(&bits, 130) == 130);
+
+	// Shrinking and regrowing leaves the regrown bits clear.
+	Test_Check(Bitset_Resize(&bits, 70));
+	Test_Check(Bitset_Count(&bits) == 70);
+	Test_Check(Bitset_Resize(&bits, 200));
+	Test_Check(Bitset_Count(&bits) == 70);
+	Test_Check(!Bitset_Test(&bits, 70) && !Bitset_Test(&bits, 199));
+
+	Bitset_Destroy(&bits);
+}
+
+static void TestSetOperations() {
+	Bitset a;
+	Bitset b;
+	Bitset c;
+	Bitset_Create(&a, 100);
+	Bitset_Create(&b, 100);
+	Bitset_Create(&c, 100);
+
+	for (U64 i = 0; i < 100; i += 2) { Bitset_Set(&a, i); }
+	for (U64 i = 0; i < 100; i += 3) { Bitset_Set(&b, i); }
+
+	Bitset_Copy(&c, &a);
+	Test_Check(Bitset_Equal(&c, &a));
+	Bitset_And(&c, &b);
+	Test_Check(Bitset_Count(&c) == 17);
+
+	Bitset_Copy(&c, &a);
+	Bitset_Or(&c, &b);
+	Test_Check(Bitset_Count(&c) == 67);
+
+	Bitset_Copy(&c, &a);
+	Bitset_AndNot(&c, &b);
+	Test_Check(Bitset_Count(&c) == 33);
+	Test_Check(!Bitset_Equal(&c, &a));
+	for (U64 i = 0; i < 100; ++i) { Test_Check(Bitset_Test(&c, i) == (i % 2 == 0 && i % 3 != 0)); }
+
+	Bitset_Destroy(&c);
+	Bitset_Destroy(&b);
+	Bitset_Destroy(&a);
+}
+
+void Test_Bitset() {
+	TestBits();
+	TestSetOperations();
+}
@@ -0,0 +1,153 @@
+#include <Obsidian/Containers/Dictionary.h>
+
+#include "Test.h"
+
+// Gives every key the same hash, so that all entries share one probe sequence across several groups.
+static U64 HashColliding(const void* key) {
+	return 0x5A5A5A5A5A5A5A5Aull;
+}
+
+static void TestInsertFind() {
+	U64* dict = Dictionary_CreateInt(U64);
+	Test_Check(dict != NULL);
+	const U64 initialCapacity = Dictionary_Capacity(&dict);
+
+	// Insert enough entries to rehash several times.
+	for (U64 i = 0; i < 1000; ++i) {
+		const U64 value = i * 3;
+		Test_Check(Dictionary_InsertInt(&dict, i * 7, value) != NULL);
+	}
+	Test_Check(Dictionary_Size(&dict) == 1000);
+	Test_Check(Dictionary_Capacity(&dict) > initialCapacity);
+
+	for (U64 i = 0; i < 1000; ++i) {
+		const U64* value = Dictionary_FindInt(&dict, i * 7);
+		Test_Check(value != NULL && *value == i * 3);
+		Test_Check(Dictionary_FindInt(&dict, (i * 7) + 1) == NULL);
+	}
+
+	// Inserting an existing key replaces its value.
+	const U64 replacement = 12345;
+	Dictionary_InsertInt(&dict, 70, replacement);
+	Test_Check(Dictionary_Size(&dict) == 1000);
+	Test_Check(*(U64*) Dictionary_FindInt(&dict, 70) == replacement);
+
+	// Iteration visits every entry exactly once.
+	const U64 capacity = Dictionary_Capacity(&dict);
+	U64 visited        = 0;
+	for (U64 slot = Dictionary_Next(&dict, 0); slot < capacity; slot = Dictionary_Next(&dict, slot + 1)) {
+		const U64 key = *(const U64*) Dictionary_KeyAt(&dict, slot);
+		Test_Check(key % 7 == 0 && key < 7000);
+		Test_Check(Dictionary_FindInt(&dict, key) == &dict[slot]);
+		visited++;
+	}
+	Test_Check(visited == 1000);
+
+	Dictionary_Clear(&dict);
+	Test_Check(Dictionary_Size(&dict) == 0);
+	Test_Check(Dictionary_FindInt(&dict, 7) == NULL);
+	Test_Check(Dictionary_Next(&dict, 0) == Dictionary_Capacity(&dict));
+
+	Dictionary_Destroy(&dict);
+}
+
+static void TestRemove() {
+	U64* dict = Dictionary_CreateInt(U64);
+
+	for (U64 i = 0; i < 500; ++i) { Dictionary_InsertInt(&dict, i, i); }
+	for (U64 i = 0; i < 500; i += 2) {
+		U64 removed = 0;
+		Test_Check(Dictionary_RemoveInt(&dict, i, &removed));
+		Test_Check(removed == i);
+		Test_Check(!Dictionary_RemoveInt(&dict, i, NULL));
+	}
+	Test_Check(Dictionary_Size(&dict) == 250);
+
+	for (U64 i = 0; i < 500; ++i) {
+		const U64* value = Dictionary_FindInt(&dict, i);
+		if (i % 2 == 0) {
+			Test_Check(value == NULL);
+		} else {
+			Test_Check(value != NULL && *value == i);
+		}
+	}
+
+	Dictionary_Destroy(&dict);
+}
+
+static void TestTombstones() {
+	U64* dict = Dictionary_Create(U64, U64, HashColliding, Dictionary_EqualInt);
+
+	for (U64 i = 0; i < 40; ++i) { Dictionary_InsertInt(&dict, i, i); }
+
+	// Removing entries from the start of the probe sequence must not hide the entries after them.
+	for (U64 i = 0; i < 20; ++i) { Test_Check(Dictionary_RemoveInt(&dict, i, NULL)); }
+	for (U64 i = 20; i < 40; ++i) {
+		const U64* value = Dictionary_FindInt(&dict, i);
+		Test_Check(value != NULL && *value == i);
+	}
+
+	// Inserting a key which is further along the sequence than a tombstone replaces it, rather than adding a duplicate
+	// in the tombstone's slot.
+	const U64 replacement = 100;
+	Dictionary_InsertInt(&dict, 30, replacement);
+	Test_Check(Dictionary_Size(&dict) == 20);
+	Test_Check(Dictionary_RemoveInt(&dict, 30, NULL));
+	Test_Check(!Dictionary_RemoveInt(&dict, 30, NULL));
+	Test_Check(Dictionary_FindInt(&dict, 30) == NULL);
+
+	// Tombstones are reused by new entries.
+	for (U64 i = 0; i < 20; ++i) { Dictionary_InsertInt(&dict, i, i); }
+	Test_Check(Dictionary_Size(&dict) == 39);
+	for (U64 i = 0; i < 40; ++i) { Test_Check((Dictionary_FindInt(&dict, i) != NULL) == (i != 30)); }
+
+	Dictionary_Destroy(&dict);
+}
+
+static void TestChurn() {
+	U64* dict = Dictionary_CreateIntWithCapacity(U64, 64);
+	for (U64 i = 0; i < 40; ++i) { Dictionary_InsertInt(&dict, i, i); }
+	const U64 capacity = Dictionary_Capacity(&dict);
+
+	// Replacing entries one at a time leaves a tombstone behind each time. Those must be cleaned up by rehashing in
+	// place rather than growing the dictionary without bound.
+	for (U64 i = 40; i < 100000; ++i) {
+		Test_Check(Dictionary_RemoveInt(&dict, i - 40, NULL));
+		Dictionary_InsertInt(&dict, i, i);
+	}
+	Test_Check(Dictionary_Size(&dict) == 40);
+	Test_Check(Dictionary_Capacity(&dict) <= capacity * 2);
+	for (U64 i = 100000 - 40; i < 100000; ++i) {
+		const U64* value = Dictionary_FindInt(&dict, i);
+		Test_Check(value != NULL && *value == i);
+	}
+
+	Dictionary_Destroy(&dict);
+}
+
+static void TestStringKeys() {
+	I32* dict = Dictionary_CreateString(I32);
+
+	const I32 one = 1;
+	const I32 two = 2;
+	Dictionary_InsertString(&dict, "One", one);
+	Dictionary_InsertString(&dict, "Two", two);
+
+	// Keys are compared by their contents, not their address.
+	char key[]       = "One";
+	const I32* value = Dictionary_FindString(&dict, key);
+	Test_Check(value != NULL && *value == 1);
+	Test_Check(Dictionary_FindString(&dict, "Three") == NULL);
+	Test_Check(Dictionary_RemoveString(&dict, "Two", NULL));
+	Test_Check(Dictionary_Size(&dict) == 1);
+
+	Dictionary_Destroy(&dict);
+}
+
+void Test_Dictionary() {
+	TestInsertFind();
+	TestRemove();
+	TestTombstones();
+	TestChurn();
+	TestStringKeys();
+}
@@ -0,0 +1,265 @@
+#include <Obsidian/Containers/DynArray.h>
+#include <Obsidian/Core/Memory.h>
+
+#include "Test.h"
+
+// Check that an array holds exactly the given values, in order.
+static B8 ArrayEquals(U32* array, const U32* expected, U64 count) {
+	if (DynArray_Size(&array) != count) { return FALSE; }
+	for (U64 i = 0; i < count; ++i) {
+		if (array[i] != expected[i]) { return FALSE; }
+	}
+
+	return TRUE;
+}
+
+static void TestPushMany() {
+	U32* array = DynArray_Create(U32);
+	Test_Check(array != NULL);
+
+	// A batch larger than the default capacity grows the array in one go.
+	U32 values[100];
+	for (U32 i = 0; i < 100; ++i) { values[i] = i; }
+	Test_Check(DynArray_PushMany(&array, values, 100));
+	Test_Check(DynArray_Capacity(&array) >= 100);
+	Test_Check(ArrayEquals(array, values, 100));
+
+	// Further batches append after the existing elements, and empty batches change nothing.
+	Test_Check(DynArray_PushMany(&array, values, 10));
+	Test_Check(DynArray_PushMany(&array, values, 0));
+	Test_Check(DynArray_Size(&array) == 110);
+	for (U32 i = 0; i < 10; ++i) { Test_Check(array[100 + i] == i); }
+
+	DynArray_Destroy(&array);
+}
+
+static void TestInsertRange() {
+	U32* array = DynArray_Create(U32);
+
+	const U32 outer[] = {0, 1, 2, 7, 8, 9};
+	const U32 inner[] = {3, 4, 5, 6};
+	Test_Check(DynArray_PushMany(&array, outer, 6));
+
+	// Inserting in the middle shifts the rest of the array along.
+	Test_Check(DynArray_InsertRange(&array, 3, inner, 4));
+	const U32 middle[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+	Test_Check(ArrayEquals(array, middle, 10));
+
+	// Inserting at either end, or nothing at all.
+	const U32 front[] = {100, 101};
+	Test_Check(DynArray_InsertRange(&array, 0, front, 2));
+	Test_Check(DynArray_InsertRange(&array, DynArray_Size(&array), front, 2));
+	Test_Check(DynArray_InsertRange(&array, 5, front, 0));
+	const U32 ends[] = {100, 101, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 100, 101};
+	Test_Check(ArrayEquals(array, ends, 14));
+
+	// Single insertions report their result too.
+	const U32 single = 50;
+	Test_Check(DynArray_Insert(&array, 1, single));
+	Test_Check(array[1] == 50 && array[2] == 101);
+	Test_Check(DynArray_Size(&array) == 15);
+
+	DynArray_Destroy(&array);
+}
+
+static void TestExtractRange() {
+	U32* array = DynArray_Create(U32);
+
+	// Extracting nothing is allowed even from an empty array, at its only valid index.
+	DynArray_ExtractRange(&array, 0, 0, NULL);
+	Test_Check(DynArray_Size(&array) == 0);
+
+	U32 values[10];
+	for (U32 i = 0; i < 10; ++i) { values[i] = i; }
+	Test_Check(DynArray_PushMany(&array, values, 10));
+
+	// Extracting from the middle copies the elements out and closes the gap.
+	U32 extracted[4] = {0};
+	DynArray_ExtractRange(&array, 3, 4, extracted);
+	const U32 removed[]   = {3, 4, 5, 6};
+	const U32 remaining[] = {0, 1, 2, 7, 8, 9};
+	for (U32 i = 0; i < 4; ++i) { Test_Check(extracted[i] == removed[i]); }
+	Test_Check(ArrayEquals(array, remaining, 6));
+
+	// Extracting nothing leaves the array as it was, including at its end.
+	DynArray_ExtractRange(&array, 2, 0, extracted);
+	DynArray_ExtractRange(&array, DynArray_Size(&array), 0, NULL);
+	Test_Check(ArrayEquals(array, remaining, 6));
+
+	// Extracting the tail, without keeping the elements, and then everything else.
+	DynArray_ExtractRange(&array, 4, 2, NULL);
+	const U32 head[] = {0, 1, 2, 7};
+	Test_Check(ArrayEquals(array, head, 4));
+	DynArray_ExtractRange(&array, 0, 4, extracted);
+	Test_Check(DynArray_Size(&array) == 0);
+	for (U32 i = 0; i < 4; ++i) { Test_Check(extracted[i] == head[i]); }
+
+	DynArray_Destroy(&array);
+}
+
+static void TestSwapRemove() {
+	U32* array = DynArray_Create(U32);
+
+	U32 values[5];
+	for (U32 i = 0; i < 5; ++i) { values[i] = i * 10; }
+	Test_Check(DynArray_PushMany(&array, values, 5));
+
+	// The last element takes the place of the removed one.
+	U32 removed = 0;
+	DynArray_SwapRemove(&array, 1, &removed);
+	Test_Check(removed == 10);
+	const U32 swapped[] = {0, 40, 20, 30};
+	Test_Check(ArrayEquals(array, swapped, 4));
+
+	// Removing the last element moves nothing.
+	DynArray_SwapRemove(&array, 3, &removed);
+	Test_Check(removed == 30);
+	const U32 shortened[] = {0, 40, 20};
+	Test_Check(ArrayEquals(array, shortened, 3));
+
+	// The removed element may be discarded.
+	DynArray_SwapRemove(&array, 0, NULL);
+	const U32 discarded[] = {20, 40};
+	Test_Check(ArrayEquals(array, discarded, 2));
+	DynArray_SwapRemove(&array, 0, NULL);
+	DynArray_SwapRemove(&array, 0, NULL);
+	Test_Check(DynArray_Size(&array) == 0);
+
+	DynArray_Destroy(&array);
+}
+
+// Scratch arrays get exactly the capacity they ask for, so they show each growth policy's choices directly.
+static void TestGrowthPolicies() {
+	const MemoryScratch scratch = Memory_ScratchBegin();
+
+	U32* exact = DynArray_CreateScratch(U32, 1);
+	DynArray_SetGrowth(&exact, DynArrayGrowth_Exact);
+	for (U32 i = 0; i < 5; ++i) {
+		Test_Check(DynArray_Push(&exact, i));
+		Test_Check(DynArray_Capacity(&exact) == i + 1);
+	}
+
+	// Powers of two, starting from the minimum growth of 4 elements.
+	U32* powers = DynArray_CreateScratch(U32, 1);
+	DynArray_SetGrowth(&powers, DynArrayGrowth_PowerOfTwo);
+	const U64 expectedPowers[] = {1, 4, 4, 4, 8, 8, 8, 8, 16};
+	for (U32 i = 0; i < 9; ++i) {
+		Test_Check(DynArray_Push(&powers, i));
+		Test_Check(DynArray_Capacity(&powers) == expectedPowers[i]);
+	}
+	U32 values[100] = {0};
+	Test_Check(DynArray_PushMany(&powers, values, 100));
+	Test_Check(DynArray_Capacity(&powers) == 128);
+
+	// Half of the current capacity, but at least 4 elements.
+	U32* geometric = DynArray_CreateScratch(U32, 1);
+	const U64 expectedGeometric[] = {1, 5, 5, 5, 5, 9, 9, 9, 9, 13, 13, 13, 13, 19};
+	for (U32 i = 0; i < 14; ++i) {
+		Test_Check(DynArray_Push(&geometric, i));
+		Test_Check(DynArray_Capacity(&geometric) == expectedGeometric[i]);
+	}
+	// A batch larger than one step grows straight to the size it needs.
+	Test_Check(DynArray_PushMany(&geometric, values, 100));
+	Test_Check(DynArray_Capacity(&geometric) == 114);
+	for (U32 i = 0; i < 14; ++i) { Test_Check(geometric[i] == i); }
+
+	Memory_ScratchEnd(scratch);
+}
+
+// Heap arrays only reallocate a handful of times while they grow, whatever the heap rounds their blocks up to.
+static void TestGrowthReallocations() {
+	U32* array = DynArray_Create(U32);
+
+	U64 capacity = DynArray_Capacity(&array);
+	U32 growths  = 0;
+	for (U32 i = 0; i < 100000; ++i) {
+		Test_Check(DynArray_Push(&array, i));
+		if (DynArray_Capacity(&array) != capacity) {
+			Test_Check(DynArray_Capacity(&array) >= capacity + capacity / 2);
+			capacity = DynArray_Capacity(&array);
+			growths++;
+		}
+	}
+	Test_Check(growths < 32);
+	for (U32 i = 0; i < 100000; ++i) { Test_Check(array[i] == i); }
+
+	// Trimming keeps room for every element, and the array can still grow afterwards.
+	Test_Check(DynArray_Trim(&array));
+	Test_Check(DynArray_Capacity(&array) >= 100000 && DynArray_Capacity(&array) <= capacity);
+	const U32 value = 7;
+	Test_Check(DynArray_Push(&array, value));
+	Test_Check(array[100000] == value);
+
+	DynArray_Destroy(&array);
+}
+
+// Virtual arrays grow as far as their reservation, and no further.
+static void TestGrowthVirtual() {
+	U32* array = DynArray_CreateVirtual(U32, 10);
+	Test_Check(array != NULL);
+
+	for (U32 i = 0; i < 10; ++i) { Test_Check(DynArray_Push(&array, i)); }
+	Test_Check(DynArray_Capacity(&array) == 10);
+	const U32 value = 10;
+	Test_Check(!DynArray_Push(&array, value));
+	Test_Check(DynArray_Size(&array) == 10);
+
+	DynArray_Destroy(&array);
+}
+
+// Get the number of live heap allocations, to see whether inline arrays have touched the heap.
+static size_t GetAllocationCount() {
+	MemoryUsage usage;
+	Memory_GetUsage(&usage);
+
+	return usage.TotalAllocations;
+}
+
+static void TestInlineSpill() {
+	const size_t allocations = GetAllocationCount();
+
+	// Filling the storage leaves the array in place, without allocating.
+	DynArray_InlineStorage(U32, 4) storage;
+	U32* array = DynArray_CreateInline(U32, storage);
+	Test_Check((void*) array == (void*) storage._Elements);
+	Test_Check(DynArray_Capacity(&array) == 4);
+	for (U32 i = 0; i < 4; ++i) { Test_Check(DynArray_Push(&array, i)); }
+	Test_Check((void*) array == (void*) storage._Elements);
+	Test_Check(GetAllocationCount() == allocations);
+
+	// Trimming can't shrink the storage, and destroying the array doesn't free it.
+	Test_Check(DynArray_Trim(&array));
+	Test_Check((void*) array == (void*) storage._Elements);
+	DynArray_Destroy(&array);
+	Test_Check(GetAllocationCount() == allocations);
+
+	// Inserting past the storage moves the array to the heap, keeping its elements in order.
+	array = DynArray_CreateInline(U32, storage);
+	const U32 outer[] = {0, 1, 6, 7};
+	const U32 inner[] = {2, 3, 4, 5};
+	Test_Check(DynArray_PushMany(&array, outer, 4));
+	Test_Check(DynArray_InsertRange(&array, 2, inner, 4));
+	Test_Check((void*) array != (void*) storage._Elements);
+	Test_Check(GetAllocationCount() == allocations + 1);
+	Test_Check(DynArray_Capacity(&array) >= 8);
+	Test_Check(DynArray_Size(&array) == 8);
+	for (U32 i = 0; i < 8; ++i) { Test_Check(array[i] == i); }
+
+	// Once on the heap, the array behaves like any other, and must be destroyed.
+	for (U32 i = 8; i < 100; ++i) { Test_Check(DynArray_Push(&array, i)); }
+	for (U32 i = 0; i < 100; ++i) { Test_Check(array[i] == i); }
+	Test_Check(DynArray_Trim(&array));
+	DynArray_Destroy(&array);
+	Test_Check(GetAllocationCount() == allocations);
+}
+
+void Test_DynArray() {
+	TestPushMany();
+	TestInsertRange();
+	TestExtractRange();
+	TestSwapRemove();
+	TestGrowthPolicies();
+	TestGrowthReallocations();
+	TestGrowthVirtual();
+	TestInlineSpill();
+}
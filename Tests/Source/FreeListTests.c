@@ -0,0 +1,38 @@
+#include <Obsidian/Containers/FreeList.h>
+
+#include "Test.h"
+
+typedef struct FreeListTestElement {
+	U32 Value;
+	FreeListNode Node;
+} FreeListTestElement;
+
+void Test_FreeList() {
+	FreeListTestElement elements[8];
+	for (U32 i = 0; i < 8; ++i) { elements[i].Value = i; }
+
+	FreeList list;
+	FreeList_Initialize(&list);
+	Test_Check(FreeList_IsEmpty(&list));
+	Test_Check(FreeList_Pop(&list) == NULL);
+
+	// An array is handed out from its first element.
+	FreeList_PushStructArray(&list, elements, 8, Node);
+	Test_Check(FreeList_Count(&list) == 8);
+	for (U32 i = 0; i < 4; ++i) {
+		FreeListNode* node = FreeList_Pop(&list);
+		Test_Check(node != NULL && FreeList_Entry(node, FreeListTestElement, Node)->Value == i);
+	}
+	Test_Check(FreeList_Count(&list) == 4);
+
+	// Returned elements are reused most recent first.
+	FreeList_Push(&list, &elements[1].Node);
+	FreeList_Push(&list, &elements[2].Node);
+	Test_Check(FreeList_Pop(&list) == &elements[2].Node);
+	Test_Check(FreeList_Pop(&list) == &elements[1].Node);
+	Test_Check(FreeList_Pop(&list) == &elements[4].Node);
+
+	while (FreeList_Pop(&list)) {}
+	Test_Check(FreeList_IsEmpty(&list));
+	Test_Check(FreeList_Count(&list) == 0);
+}
@@ -0,0 +1,92 @@
+#include <Obsidian/Containers/List.h>
+
+#include "Test.h"
+
+typedef struct ListTestElement {
+	U32 Value;
+	ListNode Node;
+} ListTestElement;
+
+// Check that a list holds the given values, in order from front to back and from back to front.
+static B8 ListEquals(const List* list, const U32* values, U64 count) {
+	U64 i = 0;
+	List_ForEach(node, list) {
+		if (i >= count || List_Entry(node, ListTestElement, Node)->Value != values[i]) { return FALSE; }
+		i++;
+	}
+	if (i != count) { return FALSE; }
+
+	for (const ListNode* node = list->Head.Prev; node != &list->Head; node = node->Prev) {
+		if (List_Entry(node, ListTestElement, Node)->Value != values[--i]) { return FALSE; }
+	}
+
+	return TRUE;
+}
+
+static void TestLinks() {
+	ListTestElement elements[6];
+	for (U32 i = 0; i < 6; ++i) {
+		elements[i].Value = i;
+		ListNode_Initialize(&elements[i].Node);
+		Test_Check(!ListNode_IsLinked(&elements[i].Node));
+	}
+
+	List list;
+	List_Initialize(&list);
+	Test_Check(List_IsEmpty(&list));
+	Test_Check(List_Front(&list) == NULL && List_Back(&list) == NULL);
+	Test_Check(List_PopFront(&list) == NULL && List_PopBack(&list) == NULL);
+
+	List_PushBack(&list, &elements[1].Node);
+	List_PushBack(&list, &elements[3].Node);
+	List_PushFront(&list, &elements[0].Node);
+	List_InsertBefore(&elements[3].Node, &elements[2].Node);
+	List_InsertAfter(&elements[3].Node, &elements[4].Node);
+	Test_Check(ListEquals(&list, (U32[]){0, 1, 2, 3, 4}, 5));
+	Test_Check(List_Front(&list) == &elements[0].Node && List_Back(&list) == &elements[4].Node);
+
+	List_Remove(&elements[2].Node);
+	Test_Check(!ListNode_IsLinked(&elements[2].Node));
+	Test_Check(ListEquals(&list, (U32[]){0, 1, 3, 4}, 4));
+
+	List_MoveToFront(&list, &elements[3].Node);
+	List_MoveToBack(&list, &elements[0].Node);
+	Test_Check(ListEquals(&list, (U32[]){3, 1, 4, 0}, 4));
+
+	Test_Check(List_PopFront(&list) == &elements[3].Node);
+	Test_Check(List_PopBack(&list) == &elements[0].Node);
+	Test_Check(!ListNode_IsLinked(&elements[3].Node) && !ListNode_IsLinked(&elements[0].Node));
+	Test_Check(ListEquals(&list, (U32[]){1, 4}, 2));
+}
+
+static void TestAppend() {
+	ListTestElement elements[6];
+	List first;
+	List second;
+	List_Initialize(&first);
+	List_Initialize(&second);
+	for (U32 i = 0; i < 6; ++i) {
+		elements[i].Value = i;
+		ListNode_Initialize(&elements[i].Node);
+		List_PushBack(i < 3 ? &first : &second, &elements[i].Node);
+	}
+
+	List_Append(&first, &second);
+	Test_Check(List_IsEmpty(&second));
+	Test_Check(ListEquals(&first, (U32[]){0, 1, 2, 3, 4, 5}, 6));
+
+	// Appending an empty list changes nothing.
+	List_Append(&first, &second);
+	Test_Check(ListEquals(&first, (U32[]){0, 1, 2, 3, 4, 5}, 6));
+
+	// Nodes can be removed while iterating safely.
+	List_ForEachSafe(node, &first) {
+		if (List_Entry(node, ListTestElement, Node)->Value % 2 == 1) { List_Remove(node); }
+	}
+	Test_Check(ListEquals(&first, (U32[]){0, 2, 4}, 3));
+}
+
+void Test_List() {
+	TestLinks();
+	TestAppend();
+}
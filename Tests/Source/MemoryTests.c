@@ -0,0 +1,86 @@
+#include <Obsidian/Core/Memory.h>
+#include <stdint.h>
+
+#include "Test.h"
+
+static B8 IsAligned(const void* ptr, size_t align) {
+	return ((uintptr_t) ptr & (align - 1)) == 0;
+}
+
+// Fill a block with a pattern which differs between blocks and offsets.
+static void FillPattern(U8* ptr, size_t bytes, U8 seed) {
+	for (size_t i = 0; i < bytes; ++i) { ptr[i] = (U8) (seed + i * 31); }
+}
+
+static B8 HasPattern(const U8* ptr, size_t bytes, U8 seed) {
+	for (size_t i = 0; i < bytes; ++i) {
+		if (ptr[i] != (U8) (seed + i * 31)) { return FALSE; }
+	}
+
+	return TRUE;
+}
+
+// Reallocating an aligned block keeps its alignment, and keeps as much of its contents as fits.
+static void TestAlignedReallocate(size_t align) {
+	U8* ptr = Memory_AllocateAligned(1000, align, MemoryTag_Game);
+	Test_Check(ptr != NULL);
+	Test_Check(IsAligned(ptr, align));
+	FillPattern(ptr, 1000, (U8) align);
+
+	// Grow the block well past its alignment, so it can't stay in place.
+	ptr = Memory_Reallocate(ptr, 200000);
+	Test_Check(ptr != NULL);
+	Test_Check(IsAligned(ptr, align));
+	Test_Check(HasPattern(ptr, 1000, (U8) align));
+	FillPattern(ptr, 200000, (U8) align);
+
+	// Shrink it again.
+	ptr = Memory_Reallocate(ptr, 100);
+	Test_Check(ptr != NULL);
+	Test_Check(IsAligned(ptr, align));
+	Test_Check(HasPattern(ptr, 100, (U8) align));
+
+	Memory_Free(ptr);
+}
+
+// Several aligned blocks live at once must not overlap or disturb each other.
+static void TestAlignedBlocks(size_t align) {
+	U8* blocks[8];
+	for (U32 i = 0; i < 8; ++i) {
+		blocks[i] = Memory_AllocateAligned(align / 2 + i, align, MemoryTag_Game);
+		Test_Check(blocks[i] != NULL && IsAligned(blocks[i], align));
+		FillPattern(blocks[i], align / 2 + i, (U8) i);
+	}
+	for (U32 i = 0; i < 8; ++i) {
+		Test_Check(HasPattern(blocks[i], align / 2 + i, (U8) i));
+		Memory_Free(blocks[i]);
+	}
+}
+
+// Small blocks come from size classes, and must keep their contents when they move between classes or to the heap.
+static void TestSmallReallocate() {
+	U8* ptr = Memory_Allocate(24, MemoryTag_Game);
+	Test_Check(ptr != NULL);
+	FillPattern(ptr, 24, 7);
+
+	const size_t sizes[] = {40, 200, 1024, 5000, 600, 16};
+	size_t size          = 24;
+	for (U32 i = 0; i < sizeof(sizes) / sizeof(*sizes); ++i) {
+		ptr = Memory_Reallocate(ptr, sizes[i]);
+		Test_Check(ptr != NULL);
+		Test_Check(HasPattern(ptr, size < sizes[i] ? size : sizes[i], 7));
+		size = sizes[i];
+		FillPattern(ptr, size, 7);
+	}
+
+	Memory_Free(ptr);
+}
+
+void Test_Memory() {
+	const size_t alignments[] = {512, 4096, 65536};
+	for (U32 i = 0; i < sizeof(alignments) / sizeof(*alignments); ++i) {
+		TestAlignedReallocate(alignments[i]);
+		TestAlignedBlocks(alignments[i]);
+	}
+	TestSmallReallocate();
+}
@@ -0,0 +1,159 @@
+#include <Obsidian/Containers/RingQueue.h>
+#include <Obsidian/Platform/Platform.h>
+#include <stdatomic.h>
+
+#include "Test.h"
+
+// Number of threads on each side of the threaded MPMC test, and the values each producer pushes.
+#define RING_QUEUE_TEST_THREADS 4
+#define RING_QUEUE_TEST_VALUES  20000
+
+typedef struct MpmcTest {
+	MpmcQueue Queue;
+	atomic_uint_fast64_t Popped; // Number of values popped by every consumer.
+	atomic_uint_fast64_t Sum;    // Sum of the values popped by every consumer.
+	atomic_uint Errors;          // Number of values popped out of order.
+} MpmcTest;
+
+typedef struct MpmcProducer {
+	MpmcTest* Test;
+	U64 Id;
+} MpmcProducer;
+
+static void TestSpsc() {
+	SpscQueue queue = SpscQueue_Create(sizeof(U32), 5);
+	Test_Check(queue != NULL);
+	const U64 capacity = SpscQueue_Capacity(queue);
+	Test_Check(capacity >= 5);
+	Test_Check((capacity & (capacity - 1)) == 0);
+
+	U32 value = 0;
+	Test_Check(!SpscQueue_Pop(queue, &value));
+
+	// Fill and drain the queue partially, many times over, so that it wraps around.
+	U32 pushed = 0;
+	U32 popped = 0;
+	for (U32 round = 0; round < 100; ++round) {
+		while (SpscQueue_Push(queue, &pushed)) { pushed++; }
+		Test_Check(SpscQueue_Size(queue) == capacity);
+		for (U64 i = 0; i < capacity / 2 + round % 2; ++i) {
+			Test_Check(SpscQueue_Pop(queue, &value));
+			Test_Check(value == popped);
+			popped++;
+		}
+	}
+	while (SpscQueue_Pop(queue, &value)) {
+		Test_Check(value == popped);
+		popped++;
+	}
+	Test_Check(pushed == popped);
+	Test_Check(SpscQueue_Size(queue) == 0);
+
+	SpscQueue_Destroy(queue);
+}
+
+static void TestMpmc() {
+	MpmcQueue queue = MpmcQueue_Create(sizeof(U32), 1);
+	Test_Check(queue != NULL);
+	Test_Check(MpmcQueue_Capacity(queue) == 2);
+	MpmcQueue_Destroy(queue);
+
+	queue = MpmcQueue_Create(sizeof(U32), 8);
+	const U64 capacity = MpmcQueue_Capacity(queue);
+	Test_Check(capacity == 8);
+
+	U32 value = 0;
+	Test_Check(!MpmcQueue_Pop(queue, &value));
+
+	U32 pushed = 0;
+	U32 popped = 0;
+	for (U32 round = 0; round < 100; ++round) {
+		while (MpmcQueue_Push(queue, &pushed)) { pushed++; }
+		Test_Check(MpmcQueue_Size(queue) == capacity);
+		for (U64 i = 0; i < capacity / 2 + round % 2; ++i) {
+			Test_Check(MpmcQueue_Pop(queue, &value));
+			Test_Check(value == popped);
+			popped++;
+		}
+	}
+	while (MpmcQueue_Pop(queue, &value)) {
+		Test_Check(value == popped);
+		popped++;
+	}
+	Test_Check(pushed == popped);
+	Test_Check(MpmcQueue_Size(queue) == 0);
+
+	MpmcQueue_Destroy(queue);
+}
+
+static void MpmcProduce(void* userData) {
+	MpmcProducer* producer = userData;
+
+	for (U64 i = 0; i < RING_QUEUE_TEST_VALUES; ++i) {
+		const U64 value = (producer->Id << 32) | i;
+		while (!MpmcQueue_Push(producer->Test->Queue, &value)) {}
+	}
+}
+
+static void MpmcConsume(void* userData) {
+	MpmcTest* test = userData;
+	const U64 total = RING_QUEUE_TEST_THREADS * RING_QUEUE_TEST_VALUES;
+
+	// Values from any one producer must arrive in the order they were pushed.
+	U64 next[RING_QUEUE_TEST_THREADS] = {0};
+	while (atomic_load(&test->Popped) < total) {
+		U64 value = 0;
+		if (!MpmcQueue_Pop(test->Queue, &value)) { continue; }
+
+		const U64 id    = value >> 32;
+		const U64 index = value & 0xFFFFFFFF;
+		if (id >= RING_QUEUE_TEST_THREADS || index < next[id]) {
+			atomic_fetch_add(&test->Errors, 1);
+		} else {
+			next[id] = index + 1;
+		}
+		atomic_fetch_add(&test->Sum, value);
+		atomic_fetch_add(&test->Popped, 1);
+	}
+}
+
+static void TestMpmcThreaded() {
+	MpmcTest test;
+	test.Queue = MpmcQueue_Create(sizeof(U64), 64);
+	atomic_init(&test.Popped, 0);
+	atomic_init(&test.Sum, 0);
+	atomic_init(&test.Errors, 0);
+	Test_Check(test.Queue != NULL);
+
+	MpmcProducer producers[RING_QUEUE_TEST_THREADS];
+	PlatformThread threads[RING_QUEUE_TEST_THREADS * 2];
+	for (U64 i = 0; i < RING_QUEUE_TEST_THREADS; ++i) {
+		producers[i] = (MpmcProducer){&test, i};
+		threads[i]   = Platform_ThreadCreate(MpmcConsume, &test);
+	}
+	for (U64 i = 0; i < RING_QUEUE_TEST_THREADS; ++i) {
+		threads[RING_QUEUE_TEST_THREADS + i] = Platform_ThreadCreate(MpmcProduce, &producers[i]);
+	}
+	for (U64 i = 0; i < RING_QUEUE_TEST_THREADS * 2; ++i) {
+		Test_Check(threads[i] != NULL);
+		if (threads[i]) { Platform_ThreadJoin(threads[i]); }
+	}
+
+	// Every value must have been popped exactly once.
+	U64 expected = 0;
+	for (U64 id = 0; id < RING_QUEUE_TEST_THREADS; ++id) {
+		for (U64 i = 0; i < RING_QUEUE_TEST_VALUES; ++i) { expected += (id << 32) | i; }
+	}
+	Test_Check(atomic_load(&test.Popped) == RING_QUEUE_TEST_THREADS * RING_QUEUE_TEST_VALUES);
+	Test_Check(atomic_load(&test.Sum) == expected);
+	Test_Check(atomic_load(&test.Errors) == 0);
+	Test_Check(MpmcQueue_Size(test.Queue) == 0);
+
+	MpmcQueue_Destroy(test.Queue);
+}
+
+void Test_RingQueue() {
+	TestSpsc();
+	TestMpmc();
+	TestMpmcThreaded();
+}
@@ -0,0 +1,122 @@
+#include <Obsidian/Containers/SlotMap.h>
+
+#include "Test.h"
+
+// Operations made by the randomized test, the most values it keeps at once, and how often it checks every handle.
+#define SLOT_MAP_TEST_OPERATIONS 200000
+#define SLOT_MAP_TEST_LIVE       1024
+#define SLOT_MAP_TEST_INTERVAL   1000
+
+static void TestInsertGet() {
+	U64* map = SlotMap_Create(U64);
+	Test_Check(map != NULL);
+
+	SlotMapHandle handles[100];
+	for (U64 i = 0; i < 100; ++i) {
+		const U64 value = i * 10;
+		handles[i]      = SlotMap_Insert(&map, value);
+		Test_Check(handles[i].Generation != 0);
+	}
+	Test_Check(SlotMap_Size(&map) == 100);
+
+	for (U64 i = 0; i < 100; ++i) {
+		const U64* value = SlotMap_Get(&map, handles[i]);
+		Test_Check(value != NULL && *value == i * 10);
+	}
+
+	Test_Check(!SlotMap_IsValid(&map, SlotMap_NullHandle));
+	Test_Check(!SlotMap_IsValid(&map, ((SlotMapHandle){1000, 1})));
+
+	SlotMap_Destroy(&map);
+}
+
+static void TestStaleHandles() {
+	U64* map = SlotMap_Create(U64);
+
+	SlotMapHandle handles[10];
+	for (U64 i = 0; i < 10; ++i) { handles[i] = SlotMap_Insert(&map, i); }
+
+	// Removing a value moves the last value into its place, but every other handle still finds its own value.
+	U64 removed = 0;
+	Test_Check(SlotMap_Remove(&map, handles[3], &removed));
+	Test_Check(removed == 3);
+	Test_Check(!SlotMap_IsValid(&map, handles[3]));
+	Test_Check(!SlotMap_Remove(&map, handles[3], NULL));
+	Test_Check(SlotMap_Size(&map) == 9);
+	for (U64 i = 0; i < 10; ++i) {
+		if (i == 3) { continue; }
+		const U64* value = SlotMap_Get(&map, handles[i]);
+		Test_Check(value != NULL && *value == i);
+	}
+
+	// A value which reuses the slot must not be reachable through the old handle.
+	const U64 reused              = 99;
+	const SlotMapHandle newHandle = SlotMap_Insert(&map, reused);
+	Test_Check(!SlotMap_IsValid(&map, handles[3]));
+	Test_Check(newHandle.Index != handles[3].Index || newHandle.Generation != handles[3].Generation);
+	Test_Check(*(U64*) SlotMap_Get(&map, newHandle) == reused);
+
+	// Handles found while iterating refer to the value at that position.
+	for (U64 i = 0; i < SlotMap_Size(&map); ++i) { Test_Check(SlotMap_Get(&map, SlotMap_HandleAt(&map, i)) == &map[i]); }
+
+	// Clearing the map invalidates every handle.
+	SlotMap_Clear(&map);
+	Test_Check(SlotMap_Size(&map) == 0);
+	Test_Check(!SlotMap_IsValid(&map, newHandle));
+	for (U64 i = 0; i < 10; ++i) { Test_Check(!SlotMap_IsValid(&map, handles[i])); }
+	const SlotMapHandle afterClear = SlotMap_Insert(&map, reused);
+	Test_Check(SlotMap_IsValid(&map, afterClear));
+	Test_Check(!SlotMap_IsValid(&map, newHandle));
+
+	SlotMap_Destroy(&map);
+}
+
+static void TestRandomized() {
+	U64* map = SlotMap_Create(U64);
+
+	// Handles of the values in the map, alongside the values they should find, and a ring of removed handles.
+	SlotMapHandle live[SLOT_MAP_TEST_LIVE];
+	U64 liveValues[SLOT_MAP_TEST_LIVE];
+	SlotMapHandle stale[SLOT_MAP_TEST_LIVE];
+	U64 liveCount  = 0;
+	U64 staleCount = 0;
+	U64 nextValue  = 0;
+	U64 random     = 0x2545F4914F6CDD1Dull;
+
+	for (U64 op = 0; op < SLOT_MAP_TEST_OPERATIONS; ++op) {
+		const U64 r = Test_Random(&random);
+		if (liveCount == 0 || (liveCount < SLOT_MAP_TEST_LIVE && (r & 1))) {
+			const U64 value       = nextValue++;
+			live[liveCount]       = SlotMap_Insert(&map, value);
+			liveValues[liveCount] = value;
+			liveCount++;
+		} else {
+			const U64 index = (r >> 1) % liveCount;
+			U64 removed     = 0;
+			Test_Check(SlotMap_Remove(&map, live[index], &removed));
+			Test_Check(removed == liveValues[index]);
+			stale[staleCount++ % SLOT_MAP_TEST_LIVE] = live[index];
+			live[index]                              = live[liveCount - 1];
+			liveValues[index]                        = liveValues[liveCount - 1];
+			liveCount--;
+		}
+
+		if (op % SLOT_MAP_TEST_INTERVAL == 0) {
+			Test_Check(SlotMap_Size(&map) == liveCount);
+			for (U64 i = 0; i < liveCount; ++i) {
+				const U64* value = SlotMap_Get(&map, live[i]);
+				Test_Check(value != NULL && *value == liveValues[i]);
+			}
+			const U64 staleKept = staleCount < SLOT_MAP_TEST_LIVE ? staleCount : SLOT_MAP_TEST_LIVE;
+			for (U64 i = 0; i < staleKept; ++i) { Test_Check(!SlotMap_IsValid(&map, stale[i])); }
+		}
+	}
+
+	SlotMap_Destroy(&map);
+}
+
+void Test_SlotMap() {
+	TestInsertGet();
+	TestStaleHandles();
+	TestRandomized();
+}
@@ -0,0 +1,122 @@
+#include <Obsidian/Containers/Sort.h>
+#include <Obsidian/Core/Memory.h>
+
+#include "Test.h"
+
+// Large enough for the parallel sorts to split the keys across every thread.
+#define SORT_TEST_COUNT 300000
+
+typedef struct SortTestElement {
+	U32 Key;
+	U32 Index;
+} SortTestElement;
+
+static I32 CompareElements(const void* a, const void* b) {
+	const U32 keyA = ((const SortTestElement*) a)->Key;
+	const U32 keyB = ((const SortTestElement*) b)->Key;
+
+	return (keyA > keyB) - (keyA < keyB);
+}
+
+// Check that keys are in ascending order and that equal keys kept their original order. Each value is the original
+// index of its key, so the values must also be a permutation of the indices.
+static B8 IsSortedStable(const void* keys, U32 keySize, const U32* values, U64 count) {
+	U8* seen = Memory_Allocate(count ? count : 1, MemoryTag_Array);
+	Memory_Zero(seen, count);
+
+	B8 sorted = TRUE;
+	for (U64 i = 0; i < count && sorted; ++i) {
+		if (values[i] >= count || seen[values[i]]) { sorted = FALSE; }
+		if (sorted) { seen[values[i]] = TRUE; }
+		if (i == 0) { continue; }
+
+		const U64 previous = keySize == sizeof(U32) ? ((const U32*) keys)[i - 1] : ((const U64*) keys)[i - 1];
+		const U64 current  = keySize == sizeof(U32) ? ((const U32*) keys)[i] : ((const U64*) keys)[i];
+		if (previous > current || (previous == current && values[i - 1] > values[i])) { sorted = FALSE; }
+	}
+	Memory_Free(seen);
+
+	return sorted;
+}
+
+// Sort keys with every radix sort, checking each result. The mask selects which bits of the keys vary.
+static void TestRadix(U64 mask, U64 count) {
+	U32* keys32   = Memory_Allocate(count * sizeof(U32), MemoryTag_Array);
+	U64* keys64   = Memory_Allocate(count * sizeof(U64), MemoryTag_Array);
+	U32* values   = Memory_Allocate(count * sizeof(U32), MemoryTag_Array);
+	U64* original = Memory_Allocate(count * sizeof(U64), MemoryTag_Array);
+
+	U64 random = 0x2545F4914F6CDD1Dull;
+	for (U64 i = 0; i < count; ++i) { original[i] = Test_Random(&random) & mask; }
+
+	for (U32 method = 0; method < 4; ++method) {
+		for (U64 i = 0; i < count; ++i) {
+			keys32[i] = original[i];
+			keys64[i] = original[i];
+			values[i] = i;
+		}
+
+		switch (method) {
+			case 0:
+				Test_Check(Sort_RadixU32(keys32, values, count, NULL));
+				Test_Check(IsSortedStable(keys32, sizeof(U32), values, count));
+				break;
+			case 1:
+				Test_Check(Sort_RadixU64(keys64, values, count, NULL));
+				Test_Check(IsSortedStable(keys64, sizeof(U64), values, count));
+				break;
+			case 2:
+				Test_Check(Sort_RadixParallelU32(keys32, values, count, 4, NULL));
+				Test_Check(IsSortedStable(keys32, sizeof(U32), values, count));
+				break;
+			default:
+				Test_Check(Sort_RadixParallelU64(keys64, values, count, 4, NULL));
+				Test_Check(IsSortedStable(keys64, sizeof(U64), values, count));
+				break;
+		}
+	}
+
+	// Sorting keys without values leaves the same keys in order.
+	for (U64 i = 0; i < count; ++i) { keys64[i] = original[i]; }
+	Test_Check(Sort_RadixParallelU64(keys64, NULL, count, 4, NULL));
+	for (U64 i = 1; i < count; ++i) { Test_Check(keys64[i - 1] <= keys64[i]); }
+
+	Memory_Free(original);
+	Memory_Free(values);
+	Memory_Free(keys64);
+	Memory_Free(keys32);
+}
+
+static void TestStable() {
+	SortTestElement* elements = Memory_Allocate(10000 * sizeof(SortTestElement), MemoryTag_Array);
+	U64 random                = 0x9E3779B97F4A7C15ull;
+	for (U32 i = 0; i < 10000; ++i) { elements[i] = (SortTestElement){Test_Random(&random) % 64, i}; }
+
+	Test_Check(Sort_Stable(elements, 10000, sizeof(SortTestElement), CompareElements, NULL));
+	for (U32 i = 1; i < 10000; ++i) {
+		const SortTestElement* a = &elements[i - 1];
+		const SortTestElement* b = &elements[i];
+		Test_Check(a->Key < b->Key || (a->Key == b->Key && a->Index < b->Index));
+	}
+
+	// Sorting nothing, or a single element, succeeds without touching the array.
+	Test_Check(Sort_Stable(elements, 0, sizeof(SortTestElement), CompareElements, NULL));
+	Test_Check(Sort_Stable(elements, 1, sizeof(SortTestElement), CompareElements, NULL));
+
+	Memory_Free(elements);
+}
+
+void Test_Sort() {
+	// Few distinct keys, so that stability matters.
+	TestRadix(0xF, SORT_TEST_COUNT);
+	// Keys which only differ in their low bytes, so that the parallel sort splits on a digit below the highest byte.
+	TestRadix(0xFFFFF, SORT_TEST_COUNT);
+	// Keys which differ in every byte.
+	TestRadix(~0ull, SORT_TEST_COUNT);
+	// Keys which are all equal.
+	TestRadix(0, SORT_TEST_COUNT);
+	// Arrays too small to sort in parallel.
+	TestRadix(~0ull, 1000);
+	TestRadix(~0ull, 1);
+	TestStable();
+}
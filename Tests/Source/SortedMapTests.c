@@ -0,0 +1,82 @@
+#include <Obsidian/Containers/SortedMap.h>
+#include <math.h>
+
+#include "Test.h"
+
+static void TestInsertFind() {
+	U32* map = SortedMap_Create(U32);
+	Test_Check(map != NULL);
+
+	// Insert keys out of order; entries are kept in key order, with values moving along with their keys.
+	for (U32 i = 0; i < 100; ++i) {
+		const U32 value = (i * 37) % 100;
+		SortedMap_Insert(&map, value * 10, value);
+	}
+	Test_Check(SortedMap_Size(&map) == 100);
+	for (U64 i = 0; i < 100; ++i) {
+		Test_Check(SortedMap_KeyAt(&map, i) == i * 10);
+		Test_Check(map[i] == i);
+	}
+
+	const U32* value = SortedMap_Find(&map, 420);
+	Test_Check(value != NULL && *value == 42);
+	Test_Check(SortedMap_Find(&map, 421) == NULL);
+
+	const U32 replacement = 1000;
+	SortedMap_Insert(&map, 420, replacement);
+	Test_Check(SortedMap_Size(&map) == 100);
+	Test_Check(*(U32*) SortedMap_Find(&map, 420) == replacement);
+
+	U32 removed = 0;
+	Test_Check(SortedMap_Remove(&map, 0, &removed));
+	Test_Check(removed == 0);
+	Test_Check(!SortedMap_Remove(&map, 0, NULL));
+	Test_Check(SortedMap_Size(&map) == 99);
+	Test_Check(SortedMap_KeyAt(&map, 0) == 10);
+
+	SortedMap_Clear(&map);
+	Test_Check(SortedMap_Size(&map) == 0);
+	Test_Check(SortedMap_Find(&map, 10) == NULL);
+
+	SortedMap_Destroy(&map);
+}
+
+static void TestBounds() {
+	U32* map                 = SortedMap_Create(U32);
+	const U64 keys[]         = {10, 20, 30, 40, 50};
+	const U32 values[]       = {1, 2, 3, 4, 5};
+	const U64 unsortedKeys[] = {10, 30, 20};
+	Test_Check(SortedMap_Build(&map, keys, values, 5));
+
+	Test_Check(SortedMap_LowerBound(&map, 5) == 0);
+	Test_Check(SortedMap_LowerBound(&map, 20) == 1);
+	Test_Check(SortedMap_LowerBound(&map, 21) == 2);
+	Test_Check(SortedMap_LowerBound(&map, 51) == 5);
+	Test_Check(SortedMap_UpperBound(&map, 20) == 2);
+	Test_Check(SortedMap_UpperBound(&map, 50) == 5);
+
+	U64 first = 0;
+	Test_Check(SortedMap_Range(&map, 15, 40, &first) == 3);
+	Test_Check(first == 1);
+	Test_Check(SortedMap_Range(&map, 41, 49, &first) == 0);
+
+	// Keys which are not strictly ascending are rejected, leaving the map as it was.
+	Test_Check(!SortedMap_Build(&map, unsortedKeys, values, 3));
+	Test_Check(SortedMap_Size(&map) == 5);
+	Test_Check(SortedMap_Keys(&map)[4] == 50 && map[4] == 5);
+
+	SortedMap_Destroy(&map);
+}
+
+static void TestFloatKeys() {
+	const F64 values[] = {-INFINITY, -1000.0, -1.5, -0.0, 0.0, 1e-300, 1.5, 1000.0, INFINITY};
+	for (U64 i = 1; i < sizeof(values) / sizeof(*values); ++i) {
+		Test_Check(SortedMap_KeyFromF64(values[i - 1]) < SortedMap_KeyFromF64(values[i]));
+	}
+}
+
+void Test_SortedMap() {
+	TestInsertFind();
+	TestBounds();
+	TestFloatKeys();
+}
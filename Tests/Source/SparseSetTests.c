@@ -0,0 +1,36 @@
+#include <Obsidian/Containers/SparseSet.h>
+
+#include "Test.h"
+
+void Test_SparseSet() {
+	U32* set = SparseSet_Create();
+	Test_Check(set != NULL);
+
+	// Values beyond the initial maximum grow the sparse array.
+	const U32 values[] = {3, 7, 15, 16, 1000, 0};
+	for (U64 i = 0; i < sizeof(values) / sizeof(*values); ++i) { Test_Check(SparseSet_Add(&set, values[i])); }
+	Test_Check(SparseSet_Add(&set, 7));
+	Test_Check(SparseSet_Size(&set) == 6);
+
+	for (U64 i = 0; i < sizeof(values) / sizeof(*values); ++i) {
+		Test_Check(SparseSet_Contains(&set, values[i]));
+		Test_Check(set[SparseSet_IndexOf(&set, values[i])] == values[i]);
+	}
+	Test_Check(!SparseSet_Contains(&set, 8));
+	Test_Check(!SparseSet_Contains(&set, 100000));
+	Test_Check(SparseSet_IndexOf(&set, 8) == SparseSet_Size(&set));
+
+	// Removing a member moves the last member into its place.
+	Test_Check(SparseSet_Remove(&set, 7));
+	Test_Check(!SparseSet_Remove(&set, 7));
+	Test_Check(!SparseSet_Contains(&set, 7));
+	Test_Check(SparseSet_Size(&set) == 5);
+	for (U64 i = 0; i < SparseSet_Size(&set); ++i) { Test_Check(SparseSet_IndexOf(&set, set[i]) == i); }
+
+	SparseSet_Clear(&set);
+	Test_Check(SparseSet_Size(&set) == 0);
+	Test_Check(!SparseSet_Contains(&set, 3));
+	Test_Check(!SparseSet_Contains(&set, 1000));
+
+	SparseSet_Destroy(&set);
+}
@@ -0,0 +1,30 @@
+#include <Obsidian/Core/StringId.h>
+#include <string.h>
+
+#include "Test.h"
+
+void Test_StringId() {
+	Test_Check(StringId_Initialize());
+
+	// Interning, hashing at runtime and hashing a literal all give the same ID.
+	const StringId id = StringId_Intern("Position");
+	Test_Check(id == StringId_FromString("Position"));
+	Test_Check(id == StringId_Literal("Position"));
+	Test_Check(id != StringId_Intern("Velocity"));
+	Test_Check(StringId_InternLength("PositionX", 8) == id);
+	Test_Check(StringId_Intern("") == StringId_Literal(""));
+
+	// Interned strings are copies, which can be found from their ID.
+	char buffer[] = "Transient";
+	const StringId transient = StringId_Intern(buffer);
+	buffer[0]                = 'X';
+	const char* interned     = StringId_GetString(transient);
+	Test_Check(interned != NULL && strcmp(interned, "Transient") == 0);
+	Test_Check(strcmp(StringId_GetString(id), "Position") == 0);
+
+	// IDs which were only hashed were never interned.
+	Test_Check(StringId_GetString(StringId_FromString("Rotation")) == NULL);
+
+	StringId_Shutdown();
+	Test_Check(StringId_GetString(id) == NULL);
+}
@@ -0,0 +1,49 @@
+/** @file
+ *  @brief Checks shared by the test suites */
+#pragma once
+
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Defines.h>
+
+/** A test suite which can be selected by name from the command line. */
+typedef struct TestSuite {
+	const char* Name; /**< Name used to select the suite. */
+	void (*Run)();    /**< Runs every test in the suite. */
+} TestSuite;
+
+/** Number of checks which have failed since the program started. */
+extern U32 Test_FailureCount;
+
+/**
+ * Check that an expression is TRUE. Otherwise, log the failed expression and carry on, so that one run reports every
+ * failure in the suite.
+ * @param expr The expression to check.
+ */
+#define Test_Check(expr)                                          \
+	do {                                                            \
+		if (!(expr)) {                                                \
+			LogE("%s:%d: Check failed: %s", __FILE__, __LINE__, #expr); \
+			Test_FailureCount++;                                        \
+		}                                                             \
+	} while (0)
+
+/**
+ * Get the next number from a pseudo-random sequence. Every sequence starts from a fixed seed, so each run checks the
+ * same data.
+ * @param state The state of the sequence, which must not be 0.
+ * @return A pseudo-random number.
+ */
+U64 Test_Random(U64* state);
+
+void Test_Bitset();
+void Test_Dictionary();
+void Test_DynArray();
+void Test_FreeList();
+void Test_List();
+void Test_Memory();
+void Test_RingQueue();
+void Test_SlotMap();
+void Test_Sort();
+void Test_SortedMap();
+void Test_SparseSet();
+void Test_StringId();
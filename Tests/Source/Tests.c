@@ -0,0 +1,84 @@
+#include <Obsidian/Core/Logger.h>
+#include <Obsidian/Core/Memory.h>
+#include <string.h>
+
+#include "Test.h"
+
+U32 Test_FailureCount = 0;
+
+static const TestSuite Suites[] = {{"Bitset", Test_Bitset},
+                                   {"Dictionary", Test_Dictionary},
+                                   {"DynArray", Test_DynArray},
+                                   {"FreeList", Test_FreeList},
+                                   {"List", Test_List},
+                                   {"Memory", Test_Memory},
+                                   {"RingQueue", Test_RingQueue},
+                                   {"SlotMap", Test_SlotMap},
+                                   {"Sort", Test_Sort},
+                                   {"SortedMap", Test_SortedMap},
+                                   {"SparseSet", Test_SparseSet},
+                                   {"StringId", Test_StringId}};
+
+U64 Test_Random(U64* state) {
+	U64 x = *state;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	*state = x;
+
+	return x;
+}
+
+static const TestSuite* FindSuite(const char* name) {
+	for (U64 i = 0; i < sizeof(Suites) / sizeof(*Suites); ++i) {
+		if (strcmp(Suites[i].Name, name) == 0) { return &Suites[i]; }
+	}
+
+	return NULL;
+}
+
+// Run a suite, checking that it frees everything it allocates.
+static void RunSuite(const TestSuite* suite) {
+	const U32 failures = Test_FailureCount;
+
+	MemoryUsage before;
+	Memory_GetUsage(&before);
+	suite->Run();
+	MemoryUsage after;
+	Memory_GetUsage(&after);
+
+	if (after.TotalAllocations != before.TotalAllocations) {
+		LogE("[%s] Leaked %zu allocations!", suite->Name, after.TotalAllocations - before.TotalAllocations);
+		Test_FailureCount++;
+	}
+
+	if (Test_FailureCount == failures) {
+		LogI("[%s] Passed.", suite->Name);
+	} else {
+		LogE("[%s] Failed %u checks.", suite->Name, Test_FailureCount - failures);
+	}
+}
+
+// Run every suite, or only those named on the command line.
+int main(int argc, const char** argv) {
+	if (!Memory_Initialize()) { return 2; }
+	Logger_Initialize();
+
+	if (argc == 1) {
+		for (U64 i = 0; i < sizeof(Suites) / sizeof(*Suites); ++i) { RunSuite(&Suites[i]); }
+	}
+	for (int arg = 1; arg < argc; ++arg) {
+		const TestSuite* suite = FindSuite(argv[arg]);
+		if (suite == NULL) {
+			LogE("Unknown test suite \"%s\"!", argv[arg]);
+			Test_FailureCount++;
+			continue;
+		}
+		RunSuite(suite);
+	}
+
+	Logger_Shutdown();
+	Memory_Shutdown();
+
+	return Test_FailureCount == 0 ? 0 : 1;
+}